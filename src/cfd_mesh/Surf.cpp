@@ -1163,15 +1163,17 @@ void Surf::BuildDistMap()
 
         FILE *fp = fopen( str, "w" );
 
+        TextBuffer buf;
         WriteMatDoubleM writeMatDouble;
 
-        writeMatDouble.write( fp, smat, string( "smat" ), nump, nump );
+        writeMatDouble.write( buf, smat, string( "smat" ), nump, nump );
 
-        writeMatDouble.write( fp, tmat, string( "tmat" ), nump, nump );
+        writeMatDouble.write( buf, tmat, string( "tmat" ), nump, nump );
 
-        fprintf( fp, "figure(2)\n" );
-        fprintf( fp, "plot( smat, tmat, smat', tmat' );\n" );
+        buf.Printf( "figure(2)\n" );
+        buf.Printf( "plot( smat, tmat, smat', tmat' );\n" );
 
+        buf.Write( fp );
         fclose( fp );
     }
 
@@ -1245,6 +1245,15 @@ enum SYM_XSEC_TYP { SYM_NONE,    /*!< No cross section symmetry. */
                     SYM_ALL    /*!< All cross section symmetry. */
 };
 
+/*!
+	\ingroup Enumerations
+*/
+/*! Enum that selects which tessellations use adaptive refinement. */
+enum TESS_ADAPT_MODE { TESS_ADAPT_NONE,	/*!< Fixed tessellation everywhere */
+                       TESS_ADAPT_ANALYSIS,	/*!< Refine the analysis (CompGeom, mesh export) tessellation only, display stays coarse */
+                       TESS_ADAPT_ALL	/*!< Refine both display and analysis tessellations */
+};
+
 /*!
 	\ingroup Enumerations
 */
@@ -8,6 +8,9 @@
 #include "VSP_Geom_API.h"
 #include "APITestSuite.h"
 #include <float.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 //Default tolerance to use for tests.  Most calculations are done as doubles and choosing single precision FLT_MIN gives some allowance for precision stackup in calculations
 #define TEST_TOL FLT_MIN
@@ -350,6 +353,298 @@ void APITestSuite::TestAnalysesWithPod()
 
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
 
+    //==== Batch Execution: Read-Only Analyses Side By Side Around CompGeom ====//
+    printf( "\tExecAnalyses\n" );
+    vsp::SetAnalysisInputDefaults( "SurfacePatches" );
+    string patch_id = vsp::ExecAnalysis( "SurfacePatches" );
+    int ncomp = vsp::GetStringResults( patch_id, "components" ).size();
+    TEST_ASSERT( ncomp > 0 );
+
+    vector < string > analyses = { "SurfacePatches", "SurfacePatches", analysis_name, "SurfacePatches" };
+    vector < string > batch_ids = vsp::ExecAnalyses( analyses );
+    TEST_ASSERT( batch_ids.size() == analyses.size() );
+    if ( batch_ids.size() == analyses.size() )
+    {
+        TEST_ASSERT( batch_ids[0] != batch_ids[1] );
+        TEST_ASSERT( vsp::GetResultsName( batch_ids[0] ) == "VehicleSurfaces" );
+        TEST_ASSERT( vsp::GetResultsName( batch_ids[1] ) == "VehicleSurfaces" );
+        TEST_ASSERT( vsp::GetResultsName( batch_ids[2] ) == "Comp_Geom" );
+        TEST_ASSERT( vsp::GetResultsName( batch_ids[3] ) == "VehicleSurfaces" );
+        TEST_ASSERT( ( int )vsp::GetStringResults( batch_ids[0], "components" ).size() == ncomp );
+        TEST_ASSERT( ( int )vsp::GetStringResults( batch_ids[1], "components" ).size() == ncomp );
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    analyses.push_back( "NotAnAnalysis" );
+    TEST_ASSERT( vsp::ExecAnalyses( analyses ).empty() );
+    TEST_ASSERT( vsp::ErrorMgr.PopLastError().GetErrorCode() == vsp::VSP_INVALID_ID );
+
+}
+
+void APITestSuite::TestWaveDragSweep()
+{
+    printf( "APITestSuite::TestWaveDragSweep()\n" );
+
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Fuselage Pod With An Overlapping Nacelle Pod ====//
+    string fuse_id = vsp::AddGeom( "POD" );
+    vsp::SetParmVal( fuse_id, "Length", "Design", 10.0 );
+    vsp::SetParmVal( fuse_id, "FineRatio", "Design", 8.0 );
+
+    string nac_id = vsp::AddGeom( "POD" );
+    vsp::SetParmVal( nac_id, "Length", "Design", 4.0 );
+    vsp::SetParmVal( nac_id, "FineRatio", "Design", 5.0 );
+    vsp::SetParmVal( nac_id, "X_Rel_Location", "XForm", 5.0 );
+    vsp::SetParmVal( nac_id, "Z_Rel_Location", "XForm", 0.5 );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string wave_id = vsp::FindContainer( "WaveDragSettings", 0 );
+    string sweep_id = vsp::FindParm( wave_id, "SweepSliceFlag", "WaveDrag" );
+    TEST_ASSERT( sweep_id.size() > 0 );
+
+    string analysis_name = "WaveDrag";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+    vsp::SetIntAnalysisInput( analysis_name, "NumSlices", vector< int >( 1, 12 ) );
+    vsp::SetIntAnalysisInput( analysis_name, "NumRotSects", vector< int >( 1, 6 ) );
+
+    //==== Slice Meshes ====//
+    vsp::SetParmVal( sweep_id, 0.0 );
+    string mesh_res_id = vsp::ExecAnalysis( analysis_name );
+    TEST_ASSERT( mesh_res_id.size() > 0 );
+
+    //==== Plane Sweep ====//
+    vsp::SetParmVal( sweep_id, 1.0 );
+    string sweep_res_id = vsp::ExecAnalysis( analysis_name );
+    TEST_ASSERT( sweep_res_id.size() > 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Both Must Give The Same Area Distributions ====//
+    int ntheta = vsp::GetNumData( sweep_res_id, "Slice_Area" );
+    TEST_ASSERT( ntheta == 6 );
+    TEST_ASSERT( vsp::GetNumData( mesh_res_id, "Slice_Area" ) == ntheta );
+
+    double max_area = 0.0;
+    double max_diff = 0.0;
+    for ( int itheta = 0; itheta < ntheta; itheta++ )
+    {
+        vector < double > mesh_area = vsp::GetDoubleResults( mesh_res_id, "Slice_Area", itheta );
+        vector < double > sweep_area = vsp::GetDoubleResults( sweep_res_id, "Slice_Area", itheta );
+        TEST_ASSERT( mesh_area.size() == sweep_area.size() );
+
+        for ( int islice = 0; islice < ( int )mesh_area.size() && islice < ( int )sweep_area.size(); islice++ )
+        {
+            max_area = std::max( max_area, mesh_area[islice] );
+            max_diff = std::max( max_diff, std::abs( mesh_area[islice] - sweep_area[islice] ) );
+        }
+    }
+    TEST_ASSERT( max_area > 0.0 );
+    TEST_ASSERT( max_diff < 1.0e-5 * max_area );
+
+    TEST_ASSERT_DELTA( vsp::GetDoubleResults( sweep_res_id, "Inlet_Area" )[0], vsp::GetDoubleResults( mesh_res_id, "Inlet_Area" )[0], 1.0e-5 * max_area );
+    TEST_ASSERT_DELTA( vsp::GetDoubleResults( sweep_res_id, "Exit_Area" )[0], vsp::GetDoubleResults( mesh_res_id, "Exit_Area" )[0], 1.0e-5 * max_area );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+}
+
+void APITestSuite::TestVecQueries()
+{
+    printf( "APITestSuite::TestVecQueries()\n" );
+
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string pod_id = vsp::AddGeom( "POD" );
+
+    //==== Parm Values ====//
+    vector < string > parm_ids;
+    parm_ids.push_back( vsp::GetParm( pod_id, "Length", "Design" ) );
+    parm_ids.push_back( vsp::GetParm( pod_id, "FineRatio", "Design" ) );
+    parm_ids.push_back( vsp::GetParm( pod_id, "X_Rel_Location", "XForm" ) );
+
+    vector < double > vals;
+    vals.push_back( 12.0 );
+    vals.push_back( 6.0 );
+    vals.push_back( 1.5 );
+
+    vector < double > set_vals = vsp::SetParmValVec( parm_ids, vals );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    TEST_ASSERT( set_vals.size() == vals.size() );
+
+    vector < double > get_vals = vsp::GetParmValVec( parm_ids );
+    TEST_ASSERT( get_vals.size() == parm_ids.size() );
+    for ( int i = 0; i < ( int )parm_ids.size() && i < ( int )get_vals.size(); i++ )
+    {
+        TEST_ASSERT_DELTA( get_vals[i], vals[i], TEST_TOL );
+        TEST_ASSERT_DELTA( get_vals[i], vsp::GetParmVal( parm_ids[i] ), TEST_TOL );
+    }
+
+    // A missing Parm is reported but does not stop the others
+    parm_ids.push_back( "NotAParm" );
+    get_vals = vsp::GetParmValVec( parm_ids );
+    TEST_ASSERT( get_vals.size() == parm_ids.size() );
+    TEST_ASSERT( vsp::ErrorMgr.PopLastError().GetErrorCode() == vsp::VSP_CANT_FIND_PARM );
+
+    vsp::Update();
+
+    //==== Surface Points And Normals ====//
+    int n = 20000;
+    vector < double > uvec( n ), wvec( n );
+    for ( int i = 0; i < n; i++ )
+    {
+        uvec[i] = ( double )( i % 97 ) / 96.0;
+        wvec[i] = ( double )( i % 89 ) / 88.0;
+    }
+
+    vector < double > px, py, pz, nx, ny, nz;
+    vsp::CompPntVec( pod_id, 0, uvec, wvec, px, py, pz );
+    vsp::CompNormVec( pod_id, 0, uvec, wvec, nx, ny, nz );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    TEST_ASSERT( px.size() == n && py.size() == n && pz.size() == n );
+    TEST_ASSERT( nx.size() == n && ny.size() == n && nz.size() == n );
+
+    vector < vec3d > pnts = vsp::CompVecPnt01( pod_id, 0, uvec, wvec );
+    TEST_ASSERT( pnts.size() == n );
+
+    double max_pnt_err = 0.0;
+    double max_norm_err = 0.0;
+    for ( int i = 0; i < n && i < ( int )px.size() && i < ( int )nx.size() && i < ( int )pnts.size(); i += 37 )
+    {
+        vec3d p = vsp::CompPnt01( pod_id, 0, uvec[i], wvec[i] );
+        vec3d nrm = vsp::CompNorm01( pod_id, 0, uvec[i], wvec[i] );
+
+        max_pnt_err = std::max( max_pnt_err, dist( p, vec3d( px[i], py[i], pz[i] ) ) );
+        max_pnt_err = std::max( max_pnt_err, dist( p, pnts[i] ) );
+        max_norm_err = std::max( max_norm_err, dist( nrm, vec3d( nx[i], ny[i], nz[i] ) ) );
+    }
+    TEST_ASSERT( max_pnt_err < 1.0e-10 );
+    TEST_ASSERT( max_norm_err < 1.0e-8 );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+}
+
+void APITestSuite::TestGeomCache()
+{
+    printf( "APITestSuite::TestGeomCache()\n" );
+
+    vsp::VSPRenew();
+    vsp::ClearGeomCache();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string pod_id = vsp::AddGeom( "POD" );
+    string len_id = vsp::GetParm( pod_id, "Length", "Design" );
+
+    vsp::SetParmValUpdate( len_id, 10.0 );
+    vec3d p10 = vsp::CompPnt01( pod_id, 0, 0.3, 0.4 );
+    TEST_ASSERT( vsp::GetGeomCacheMisses() > 0 );
+
+    //==== Returning To Earlier Values Hits The Cache ====//
+    int hits = vsp::GetGeomCacheHits();
+    vsp::SetParmValUpdate( len_id, 12.0 );
+    vec3d p12 = vsp::CompPnt01( pod_id, 0, 0.3, 0.4 );
+    vsp::SetParmValUpdate( len_id, 10.0 );
+    TEST_ASSERT( vsp::GetGeomCacheHits() > hits );
+    TEST_ASSERT_DELTA( dist( p10, vsp::CompPnt01( pod_id, 0, 0.3, 0.4 ) ), 0.0, TEST_TOL );
+
+    //==== An Identical Copy Shares The Cached Surface ====//
+    hits = vsp::GetGeomCacheHits();
+    string pod2_id = vsp::AddGeom( "POD" );
+    vsp::SetParmValUpdate( pod2_id, "Length", "Design", 12.0 );
+    TEST_ASSERT( vsp::GetGeomCacheHits() > hits );
+    TEST_ASSERT_DELTA( dist( p12, vsp::CompPnt01( pod2_id, 0, 0.3, 0.4 ) ), 0.0, TEST_TOL );
+
+    //==== A Moved Copy Does Not ====//
+    int misses = vsp::GetGeomCacheMisses();
+    vsp::SetParmValUpdate( pod2_id, "Y_Rel_Location", "XForm", 5.0 );
+    vsp::SetParmValUpdate( pod2_id, "Length", "Design", 10.0 );
+    TEST_ASSERT( vsp::GetGeomCacheMisses() > misses );
+    TEST_ASSERT_DELTA( dist( p10 + vec3d( 0.0, 5.0, 0.0 ), vsp::CompPnt01( pod2_id, 0, 0.3, 0.4 ) ), 0.0, TEST_TOL );
+
+    //==== Fuselage Child Of A Pod ====//
+    string fuse_id = vsp::AddGeom( "FUSELAGE", pod_id );
+    string fuse_len_id = vsp::GetParm( fuse_id, "Length", "Design" );
+    vsp::SetParmValUpdate( fuse_len_id, 20.0 );
+    vec3d f20 = vsp::CompPnt01( fuse_id, 0, 0.3, 0.4 );
+    vsp::SetParmValUpdate( fuse_len_id, 22.0 );
+    hits = vsp::GetGeomCacheHits();
+    vsp::SetParmValUpdate( fuse_len_id, 20.0 );
+    TEST_ASSERT( vsp::GetGeomCacheHits() > hits );
+    TEST_ASSERT_DELTA( dist( f20, vsp::CompPnt01( fuse_id, 0, 0.3, 0.4 ) ), 0.0, TEST_TOL );
+
+    //==== Moving The Parent Misses For The Child ====//
+    vsp::SetParmValUpdate( pod_id, "X_Rel_Location", "XForm", 3.0 );
+    misses = vsp::GetGeomCacheMisses();
+    vsp::SetParmValUpdate( fuse_len_id, 22.0 );
+    TEST_ASSERT( vsp::GetGeomCacheMisses() > misses );
+
+    //==== Disabled Cache ====//
+    vsp::SetGeomCacheSize( 0 );
+    hits = vsp::GetGeomCacheHits();
+    vsp::SetParmValUpdate( len_id, 12.0 );
+    vsp::SetParmValUpdate( len_id, 10.0 );
+    TEST_ASSERT( vsp::GetGeomCacheHits() == hits );
+    TEST_ASSERT_DELTA( dist( p10, vsp::CompPnt01( pod_id, 0, 0.3, 0.4 ) ), 0.0, TEST_TOL );
+
+    vsp::SetGeomCacheSize( 32 );
+    vsp::ClearGeomCache();
+    TEST_ASSERT( vsp::GetGeomCacheHits() == 0 && vsp::GetGeomCacheMisses() == 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+}
+
+void APITestSuite::TestDegenGeomFlat()
+{
+    printf( "APITestSuite::TestDegenGeomFlat()\n" );
+
+    vsp::VSPRenew();
+
+    string pod_id = vsp::AddGeom( "POD" );
+    string wing_id = vsp::AddGeom( "WING" );
+    string pod2_id = vsp::AddGeom( "POD" );
+    vsp::SetParmValUpdate( pod2_id, "X_Rel_Location", "XForm", 10.0 );
+
+    vsp::ComputeDegenGeom( vsp::SET_ALL, 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Components Come Back In Geom Order ====//
+    string degen_id = vsp::FindLatestResultsID( "DegenGeom" );
+    vector< string > dg_ids = vsp::GetStringResults( degen_id, "Degen_DegenGeoms" );
+    TEST_ASSERT( dg_ids.size() == 4 );  // Pod, two wing sides, pod
+    if ( dg_ids.size() != 4 )
+    {
+        return;
+    }
+    TEST_ASSERT( vsp::GetStringResults( dg_ids[0], "geom_id" )[0] == pod_id );
+    TEST_ASSERT( vsp::GetStringResults( dg_ids[1], "geom_id" )[0] == wing_id );
+    TEST_ASSERT( vsp::GetStringResults( dg_ids[2], "geom_id" )[0] == wing_id );
+    TEST_ASSERT( vsp::GetStringResults( dg_ids[3], "geom_id" )[0] == pod2_id );
+
+    //==== Flat Arrays Match The Nested Results ====//
+    string surf_id = vsp::GetStringResults( dg_ids[1], "surf" )[0];
+    vector< vector< double > > xmat = vsp::GetDoubleMatResults( surf_id, "x" );
+    vector< double > xflat = vsp::GetDoubleMatResultsFlat( surf_id, "x" );
+
+    int nxsecs = vsp::GetIntResults( surf_id, "nxsecs" )[0];
+    int npnts = vsp::GetIntResults( surf_id, "num_pnts" )[0];
+    TEST_ASSERT( ( int )xflat.size() == nxsecs * npnts );
+    for ( int i = 0; i < ( int )xmat.size(); i++ )
+    {
+        for ( int j = 0; j < ( int )xmat[i].size(); j++ )
+        {
+            TEST_ASSERT_DELTA( xflat[ i * npnts + j ], xmat[i][j], TEST_TOL );
+        }
+    }
+
+    string stick_id = vsp::GetStringResults( dg_ids[1], "sticks" )[0];
+    vector< vec3d > le = vsp::GetVec3dResults( stick_id, "le" );
+    vector< double > le_flat = vsp::GetVec3dResultsFlat( stick_id, "le" );
+    TEST_ASSERT( le_flat.size() == 3 * le.size() );
+    for ( int i = 0; i < ( int )le.size(); i++ )
+    {
+        TEST_ASSERT_DELTA( dist( le[i], vec3d( le_flat[ 3 * i ], le_flat[ 3 * i + 1 ], le_flat[ 3 * i + 2 ] ) ), 0.0, TEST_TOL );
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
 }
 
 void APITestSuite::TestDXFExport()
@@ -613,6 +908,62 @@ void APITestSuite::TestSaveLoad()
     printf( "\n" );
 }
 
+void APITestSuite::TestLoadSpeed()
+{
+    printf( "APITestSuite::TestLoadSpeed()\n" );
+
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Build 500 Geom Model With A CompGeom Mesh ====//
+    int num_geom = 500;
+    for ( int i = 0; i < 10; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmVal( pod_id, "X_Rel_Location", "XForm", 2.0 * i );
+    }
+    vsp::Update();
+    string mesh_id = vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+    TEST_ASSERT( mesh_id.size() > 0 );
+
+    while ( ( int )vsp::FindGeoms().size() < num_geom )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 0.1 * vsp::FindGeoms().size() );
+    }
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string fname = "apitest_LoadSpeed.vsp3";
+    vsp::WriteVSPFile( fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Time Read ====//
+    vsp::VSPRenew();
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    vsp::ReadVSPFile( fname );
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    printf( "\tRead %d geoms in %.1f ms\n", ( int )vsp::FindGeoms().size(),
+            std::chrono::duration < double, std::milli > ( t1 - t0 ).count() );
+    vector< string > geoms = vsp::FindGeoms();
+    TEST_ASSERT( ( int )geoms.size() == num_geom );
+
+    int num_mesh = 0;
+    for ( int i = 0; i < ( int )geoms.size(); i++ )
+    {
+        if ( vsp::GetGeomTypeName( geoms[i] ) == "Mesh" )
+        {
+            num_mesh++;
+        }
+    }
+    TEST_ASSERT( num_mesh == 1 );
+
+    printf( "\n" );
+}
+
 void APITestSuite::TestFEAMesh()
 {
     printf( "APITestSuite::TestFEAMesh()\n" );
@@ -29,6 +29,10 @@ public:
         // Analysis
         TEST_ADD( APITestSuite::CheckAnalysisMgr )
         TEST_ADD( APITestSuite::TestAnalysesWithPod )
+        TEST_ADD( APITestSuite::TestWaveDragSweep )
+        TEST_ADD( APITestSuite::TestVecQueries )
+        TEST_ADD( APITestSuite::TestGeomCache )
+        TEST_ADD( APITestSuite::TestDegenGeomFlat )
 
         // Export
         TEST_ADD( APITestSuite::TestDXFExport )
@@ -36,6 +40,7 @@ public:
         TEST_ADD( APITestSuite::TestFacetExport )
         // Save and Load
         TEST_ADD( APITestSuite::TestSaveLoad )
+        TEST_ADD( APITestSuite::TestLoadSpeed )
         // FEA Mesh
         TEST_ADD( APITestSuite::TestFEAMesh )
         // XSec
@@ -53,12 +58,17 @@ private:
     // Analysis
     void CheckAnalysisMgr();
     void TestAnalysesWithPod();
+    void TestWaveDragSweep();
+    void TestVecQueries();
+    void TestGeomCache();
+    void TestDegenGeomFlat();
     // Export
     void TestDXFExport();
     void TestSVGExport();
     void TestFacetExport();
     // Save and Load
     void TestSaveLoad();
+    void TestLoadSpeed();
     // FEA Mesh
     void TestFEAMesh();
     // XSec
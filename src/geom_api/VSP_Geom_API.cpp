@@ -20,6 +20,7 @@
 #include "CfdMeshMgr.h"
 #include "DesignVarMgr.h"
 #include "FeaMeshMgr.h"
+#include "GeomCacheMgr.h"
 #include "LinkMgr.h"
 #include "main.h"
 #include "MeasureMgr.h"
@@ -40,6 +41,8 @@
 
 #include "eli/mutil/quad/simpson.hpp"
 
+#include <thread>
+
 #ifdef __JETBRAINS_IDE__
 #define VSP_USE_FLTK 1
 #endif
@@ -69,6 +72,122 @@ Vehicle* GetVehicle()
     return veh;
 }
 
+// Evaluate surface points and/or normals at (u,w) 0 - 1 pairs with the batched
+// VspSurf evaluators.  Large inputs are split into chunks evaluated in parallel.
+void CompSurfVec01( const VspSurf *surf, const vector < double > &us, const vector < double > &ws, vector < vec3d > *pnts, vector < vec3d > *norms )
+{
+    int npt = us.size();
+    vector < double > u( npt ), w( npt );
+
+    double umax = surf->GetUMax();
+    double wmax = surf->GetWMax();
+    for ( int i = 0; i < npt; i++ )
+    {
+        u[i] = clamp( us[i], 0.0, 1.0 ) * umax;
+        w[i] = clamp( ws[i], 0.0, 1.0 ) * wmax;
+    }
+
+    const int min_chunk = 4096;
+    int num_threads = std::min( ( int )std::thread::hardware_concurrency(), npt / min_chunk );
+
+    if ( num_threads <= 1 )
+    {
+        if ( pnts ) surf->CompPntVec( u, w, *pnts );
+        if ( norms ) surf->CompNormVec( u, w, *norms );
+        return;
+    }
+
+    if ( pnts ) pnts->resize( npt );
+    if ( norms ) norms->resize( npt );
+
+    vector < std::thread > threads;
+    threads.reserve( num_threads );
+    for ( int t = 0; t < num_threads; t++ )
+    {
+        int start = ( int )( ( long long )npt * t / num_threads );
+        int end = ( int )( ( long long )npt * ( t + 1 ) / num_threads );
+
+        threads.emplace_back( [ &, start, end ]()
+        {
+            vector < double > uc( u.begin() + start, u.begin() + end );
+            vector < double > wc( w.begin() + start, w.begin() + end );
+            vector < vec3d > out;
+
+            if ( pnts )
+            {
+                surf->CompPntVec( uc, wc, out );
+                std::copy( out.begin(), out.end(), pnts->begin() + start );
+            }
+            if ( norms )
+            {
+                surf->CompNormVec( uc, wc, out );
+                std::copy( out.begin(), out.end(), norms->begin() + start );
+            }
+        } );
+    }
+
+    for ( int t = 0; t < num_threads; t++ )
+    {
+        threads[t].join();
+    }
+}
+
+// Shared body of CompPntVec and CompNormVec -- evaluate points or normals and
+// return them as separate x, y, z arrays.
+void CompSurfVecXYZ01( const string &func_name, const std::string &geom_id, const int &surf_indx, const vector < double > &us, const vector < double > &ws, bool norm_flag, vector < double > &x_out_vec, vector < double > &y_out_vec, vector < double > &z_out_vec )
+{
+    x_out_vec.clear();
+    y_out_vec.clear();
+    z_out_vec.clear();
+
+    Vehicle* veh = GetVehicle();
+
+    Geom* geom_ptr = veh->FindGeom( geom_id );
+
+    if ( !geom_ptr )
+    {
+        ErrorMgr.AddError( VSP_INVALID_GEOM_ID, func_name + "::Can't Find Geom " + geom_id );
+        return;
+    }
+
+    if ( us.size() != ws.size() )
+    {
+        ErrorMgr.AddError( VSP_INDEX_OUT_RANGE, func_name + "::Input size mismatch." );
+        return;
+    }
+
+    const VspSurf *surf = geom_ptr->GetSurfPtr( surf_indx );
+
+    if ( !surf )
+    {
+        ErrorMgr.AddError( VSP_INDEX_OUT_RANGE, func_name + "::Invalid surf index " + to_string( surf_indx ) );
+        return;
+    }
+
+    vector < vec3d > vecs;
+    if ( norm_flag )
+    {
+        CompSurfVec01( surf, us, ws, NULL, &vecs );
+    }
+    else
+    {
+        CompSurfVec01( surf, us, ws, &vecs, NULL );
+    }
+
+    int npt = vecs.size();
+    x_out_vec.resize( npt );
+    y_out_vec.resize( npt );
+    z_out_vec.resize( npt );
+    for ( int i = 0; i < npt; i++ )
+    {
+        x_out_vec[i] = vecs[i].x();
+        y_out_vec[i] = vecs[i].y();
+        z_out_vec[i] = vecs[i].z();
+    }
+
+    ErrorMgr.NoError();
+}
+
 // Find the pointer to a XSecSurf given its id
 XSecSurf* FindXSecSurf( const string & id )
 {
@@ -175,6 +294,30 @@ int GetAndResetUpdateCount()
     return (int) UpdateCountMgr.GetAndResetUpdateCount();
 }
 
+void SetGeomCacheSize( int max_size )
+{
+    GeomCacheMgr.SetMaxSize( max_size );
+    ErrorMgr.NoError();
+}
+
+int GetGeomCacheHits()
+{
+    ErrorMgr.NoError();
+    return GeomCacheMgr.GetNumHits();
+}
+
+int GetGeomCacheMisses()
+{
+    ErrorMgr.NoError();
+    return GeomCacheMgr.GetNumMisses();
+}
+
+void ClearGeomCache()
+{
+    GeomCacheMgr.Clear();
+    ErrorMgr.NoError();
+}
+
 void RegisterCFDMeshAnalyses()
 {
     SurfaceIntersectionMgr.RegisterAnalysis();
@@ -1165,6 +1308,21 @@ string ExecAnalysis( const string & analysis )
     return AnalysisMgr.ExecAnalysis( analysis );
 }
 
+vector < string > ExecAnalyses( const vector < string > & analyses )
+{
+    for ( int i = 0 ; i < ( int )analyses.size() ; i++ )
+    {
+        if ( !AnalysisMgr.ValidAnalysisName( analyses[i] ) )
+        {
+            ErrorMgr.AddError( VSP_INVALID_ID, "ExecAnalyses::Invalid Analysis ID " + analyses[i] );
+            vector < string > ret;
+            return ret;
+        }
+    }
+
+    return AnalysisMgr.ExecAnalyses( analyses );
+}
+
 int GetNumAnalysisInputData( const string & analysis, const string & name )
 {
     if ( !AnalysisMgr.ValidAnalysisName( analysis ) )
@@ -1536,6 +1694,26 @@ const vector< vector<double> > & GetDoubleMatResults( const string & id, const s
     return ResultsMgr.GetDoubleMatResults( id, name, index );
 }
 
+/// Return the double matrix given the results id, data name and data index as one row-major array
+vector< double > GetDoubleMatResultsFlat( const string & id, const string & name, int index )
+{
+    const vector< vector< double > > & mat = GetDoubleMatResults( id, name, index );
+
+    size_t n = 0;
+    for ( size_t i = 0; i < mat.size(); i++ )
+    {
+        n += mat[i].size();
+    }
+
+    vector< double > flat;
+    flat.reserve( n );
+    for ( size_t i = 0; i < mat.size(); i++ )
+    {
+        flat.insert( flat.end(), mat[i].begin(), mat[i].end() );
+    }
+    return flat;
+}
+
 /// Return the string data given the results id, data name and data index
 const vector<string> & GetStringResults( const string & id, const string & name, int index )
 {
@@ -1574,6 +1752,21 @@ const vector<vec3d> & GetVec3dResults( const string & id, const string & name, i
     return ResultsMgr.GetVec3dResults( id, name, index );
 }
 
+/// Return the vec3d data given the results id, data name and data index as packed x, y, z triples
+vector< double > GetVec3dResultsFlat( const string & id, const string & name, int index )
+{
+    const vector< vec3d > & pnts = GetVec3dResults( id, name, index );
+
+    vector< double > flat( 3 * pnts.size() );
+    for ( size_t i = 0; i < pnts.size(); i++ )
+    {
+        flat[ 3 * i ] = pnts[i].x();
+        flat[ 3 * i + 1 ] = pnts[i].y();
+        flat[ 3 * i + 2 ] = pnts[i].z();
+    }
+    return flat;
+}
+
 /// Create Geometry Results (Only Mesh Geom For Now) - Return Result ID
 extern string CreateGeomResults( const string & geom_id, const string & name )
 {
@@ -6785,6 +6978,38 @@ double SetParmVal( const string & parm_id, double val )
     return p->Set( val );
 }
 
+/// Set the values of a vector of parms.  The final value of each parm is returned.
+vector < double > SetParmValVec( const vector < string > & parm_id_vec, const vector < double > & val_vec )
+{
+    if ( parm_id_vec.size() != val_vec.size() )
+    {
+        ErrorMgr.AddError( VSP_INDEX_OUT_RANGE, "SetParmValVec::Input size mismatch." );
+        return val_vec;
+    }
+
+    vector < double > out_vec( val_vec );
+    int nmissing = 0;
+
+    for ( int i = 0; i < ( int )parm_id_vec.size(); i++ )
+    {
+        Parm* p = ParmMgr.FindParm( parm_id_vec[i] );
+        if ( p )
+        {
+            out_vec[i] = p->Set( val_vec[i] );
+        }
+        else if ( nmissing++ == 0 )
+        {
+            ErrorMgr.AddError( VSP_CANT_FIND_PARM, "SetParmValVec::Can't Find Parm " + parm_id_vec[i] );
+        }
+    }
+
+    if ( nmissing == 0 )
+    {
+        ErrorMgr.NoError();
+    }
+    return out_vec;
+}
+
 /// Set the parm value.  If update is true, the parm container is updated.
 /// The final value of parm is returned.
 double SetParmVal( const string & container_id, const string & name, const string & group, double val )
@@ -6858,6 +7083,58 @@ double GetParmVal( const string & parm_id )
     return p->Get();
 }
 
+/// Get the values of a vector of parms.  Missing parms return 0.
+vector < double > GetParmValVec( const vector < string > & parm_id_vec )
+{
+    vector < double > val_vec( parm_id_vec.size(), 0.0 );
+    int nmissing = 0;
+
+    for ( int i = 0; i < ( int )parm_id_vec.size(); i++ )
+    {
+        Parm* p = ParmMgr.FindParm( parm_id_vec[i] );
+        if ( p )
+        {
+            val_vec[i] = p->Get();
+        }
+        else if ( nmissing++ == 0 )
+        {
+            ErrorMgr.AddError( VSP_CANT_FIND_PARM, "GetParmValVec::Can't Find Parm " + parm_id_vec[i] );
+        }
+    }
+
+    if ( nmissing == 0 )
+    {
+        ErrorMgr.NoError();
+    }
+    return val_vec;
+}
+
+/// Turn undo recording of parm changes on or off
+void SetUndoFlag( bool flag )
+{
+    ParmMgr.SetUndoFlag( flag );
+    ErrorMgr.NoError();
+}
+
+bool GetUndoFlag()
+{
+    ErrorMgr.NoError();
+    return ParmMgr.GetUndoFlag();
+}
+
+/// Group the following parm changes into one undo step
+void BeginUndoGroup()
+{
+    ParmMgr.BeginUndoGroup();
+    ErrorMgr.NoError();
+}
+
+void EndUndoGroup()
+{
+    ParmMgr.EndUndoGroup();
+    ErrorMgr.NoError();
+}
+
 /// Get the value of parm
 double GetParmVal( const string & container_id, const string & name, const string & group )
 {
@@ -8583,12 +8860,7 @@ vector < vec3d > CompVecPnt01( const std::string &geom_id, const int &surf_indx,
 
             if ( surf )
             {
-                pts.resize( us.size() );
-
-                for ( int i = 0; i < us.size(); i++ )
-                {
-                    pts[i] = surf->CompPnt01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ) );
-                }
+                CompSurfVec01( surf, us, ws, &pts, NULL );
             }
             else
             {
@@ -8628,12 +8900,7 @@ vector < vec3d > CompVecNorm01( const std::string &geom_id, const int &surf_indx
 
             if ( surf )
             {
-                norms.resize( us.size() );
-
-                for ( int i = 0; i < us.size(); i++ )
-                {
-                    norms[i] = surf->CompNorm01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ) );
-                }
+                CompSurfVec01( surf, us, ws, NULL, &norms );
             }
             else
             {
@@ -8656,6 +8923,16 @@ vector < vec3d > CompVecNorm01( const std::string &geom_id, const int &surf_indx
     return norms;
 }
 
+void CompPntVec( const std::string &geom_id, const int &surf_indx, const vector < double > &us, const vector < double > &ws, vector < double > &x_out_vec, vector < double > &y_out_vec, vector < double > &z_out_vec )
+{
+    CompSurfVecXYZ01( "CompPntVec", geom_id, surf_indx, us, ws, false, x_out_vec, y_out_vec, z_out_vec );
+}
+
+void CompNormVec( const std::string &geom_id, const int &surf_indx, const vector < double > &us, const vector < double > &ws, vector < double > &x_out_vec, vector < double > &y_out_vec, vector < double > &z_out_vec )
+{
+    CompSurfVecXYZ01( "CompNormVec", geom_id, surf_indx, us, ws, true, x_out_vec, y_out_vec, z_out_vec );
+}
+
 void CompVecCurvature01( const std::string &geom_id, const int &surf_indx, const vector < double > &us, const vector < double > &ws, vector < double > &k1_out_vec, vector < double > &k2_out_vec, vector < double > &ka_out_vec, vector < double > &kg_out_vec )
 {
     Vehicle* veh = GetVehicle();
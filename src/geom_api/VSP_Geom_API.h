@@ -349,6 +349,54 @@ extern void VSPExit( int error_code );
 
 extern int GetAndResetUpdateCount();
 
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Set the number of Geom surface updates kept in the geometry cache.
+
+    Geoms that support caching reuse the surfaces and tessellation from an earlier update when all of the Parms
+    that shape them return to values seen before.  The least recently used updates are dropped once the cache is
+    full.  A size of zero disables the cache.
+
+    \sa GetGeomCacheHits, GetGeomCacheMisses, ClearGeomCache
+    \param [in] max_size Maximum number of cached updates
+*/
+
+extern void SetGeomCacheSize( int max_size );
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Return the number of Geom surface updates served from the geometry cache since it was last cleared
+    \sa SetGeomCacheSize, GetGeomCacheMisses, ClearGeomCache
+    \return int Number of cache hits
+*/
+
+extern int GetGeomCacheHits();
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Return the number of Geom surface updates that were not found in the geometry cache since it was last cleared
+    \sa SetGeomCacheSize, GetGeomCacheHits, ClearGeomCache
+    \return int Number of cache misses
+*/
+
+extern int GetGeomCacheMisses();
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Remove all entries from the geometry cache and reset its hit and miss counts
+    \sa SetGeomCacheSize, GetGeomCacheHits, GetGeomCacheMisses
+*/
+
+extern void ClearGeomCache();
+
 
 /*!
     \ingroup APIUtilities
@@ -1682,6 +1730,35 @@ extern std::string GetAnalysisInputDoc( const std::string & analysis, const std:
 
 extern std::string ExecAnalysis( const std::string & analysis );
 
+/*!
+    \ingroup Analysis
+*/
+/*!
+    Execute a list of analyses in order and wait for all of them to finish. Consecutive analyses that only read the vehicle
+    (BladeElement, EmintonLord and SurfacePatches) run at the same time on separate threads. Any other analysis runs by
+    itself, after the ones before it and before the ones after it.
+    \forcpponly
+    \code{.cpp}
+    array< string > analyses = { "SurfacePatches", "CompGeom", "SurfacePatches" };
+
+    array< string > @res_ids = ExecAnalyses( analyses );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    analyses = [ "SurfacePatches", "CompGeom", "SurfacePatches" ]
+
+    res_ids = ExecAnalyses( analyses )
+
+    \endcode
+    \endPythonOnly
+    \sa ExecAnalysis
+    \param [in] analyses Array of analysis names
+    \return Array of result IDs in the order of the analysis names, empty if any name is invalid
+*/
+
+extern std::vector<std::string> ExecAnalyses( const std::vector<std::string> & analyses );
+
 
 /*!
     \ingroup Analysis
@@ -2572,6 +2649,22 @@ extern const std::vector< double > & GetDoubleResults( const std::string & id, c
 
 extern const std::vector< std::vector< double > > & GetDoubleMatResults( const std::string & id, const std:: string & name, int index = 0 );
 
+/*!
+    \ingroup Results
+*/
+/*!
+    Get a matrix (vector<vector<double>>) result as one contiguous row-major array. Rows are concatenated in order,
+    so a DegenGeom surface or plate matrix can be handed to numpy and reshaped with its nxsecs and num_pnts results
+    without a per-row conversion.
+    \sa GetDoubleMatResults
+    \param [in] id Result ID
+    \param [in] name Data name
+    \param [in] index Data index
+    \return Array of data values, row by row
+*/
+
+extern std::vector< double > GetDoubleMatResultsFlat( const std::string & id, const std:: string & name, int index = 0 );
+
 /*!
     \ingroup Results
 */
@@ -2668,6 +2761,20 @@ extern const std::vector<std::string> & GetStringResults( const std::string & id
 
 extern const std::vector< vec3d > & GetVec3dResults( const std::string & id, const std::string & name, int index = 0 );
 
+/*!
+    \ingroup Results
+*/
+/*!
+    Get all vec3d values for a particular result, name, and index as one contiguous array of x, y, z triples
+    \sa GetVec3dResults
+    \param [in] id Result ID
+    \param [in] name Data name
+    \param [in] index Data index
+    \return Array of 3 * N coordinate values
+*/
+
+extern std::vector< double > GetVec3dResultsFlat( const std::string & id, const std::string & name, int index = 0 );
+
 /*!
     \ingroup Results
 */
@@ -11510,6 +11617,44 @@ extern bool ValidParm( const std::string & id );
 
 extern double SetParmVal( const std::string & parm_id, double val );
 
+/*!
+    \ingroup Parm
+*/
+/*!
+    Set the value of each Parm in a vector of Parm IDs. Parms that can't be found are skipped and an error is set.
+    \forcpponly
+    \code{.cpp}
+    // Add Pod Geom
+    string pod_id = AddGeom( "POD", "" );
+
+    array< string > parm_ids;
+    parm_ids.push_back( GetParm( pod_id, "Length", "Design" ) );
+    parm_ids.push_back( GetParm( pod_id, "FineRatio", "Design" ) );
+
+    array< double > vals = { 12.0, 6.0 };
+
+    SetParmValVec( parm_ids, vals );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    # Add Pod Geom
+    pod_id = AddGeom( "POD", "" )
+
+    parm_ids = [ GetParm( pod_id, "Length", "Design" ), GetParm( pod_id, "FineRatio", "Design" ) ]
+
+    SetParmValVec( parm_ids, [ 12.0, 6.0 ] )
+
+    \endcode
+    \endPythonOnly
+    \sa SetParmVal, GetParmValVec
+    \param [in] parm_id_vec vector<string> Parm IDs
+    \param [in] val_vec vector<double> Parm values to set, one per Parm ID
+    \return vector<double> Values that the Parms were set to
+*/
+
+extern std::vector < double > SetParmValVec( const std::vector < std::string > & parm_id_vec, const std::vector < double > & val_vec );
+
 /*!
     \ingroup Parm
 */
@@ -11718,6 +11863,175 @@ extern double SetParmValUpdate( const std::string & geom_id, const std::string &
 
 extern double GetParmVal( const std::string & parm_id );
 
+/*!
+    \ingroup Parm
+*/
+/*!
+    Get the value of each Parm in a vector of Parm IDs. Parms that can't be found return 0 and an error is set.
+    \forcpponly
+    \code{.cpp}
+    // Add Pod Geom
+    string pod_id = AddGeom( "POD", "" );
+
+    array< string > parm_ids;
+    parm_ids.push_back( GetParm( pod_id, "Length", "Design" ) );
+    parm_ids.push_back( GetParm( pod_id, "FineRatio", "Design" ) );
+
+    array< double > vals = GetParmValVec( parm_ids );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    # Add Pod Geom
+    pod_id = AddGeom( "POD", "" )
+
+    parm_ids = [ GetParm( pod_id, "Length", "Design" ), GetParm( pod_id, "FineRatio", "Design" ) ]
+
+    vals = GetParmValVec( parm_ids )
+
+    \endcode
+    \endPythonOnly
+    \sa GetParmVal, SetParmValVec
+    \param [in] parm_id_vec vector<string> Parm IDs
+    \return vector<double> Parm values
+*/
+
+extern std::vector < double > GetParmValVec( const std::vector < std::string > & parm_id_vec );
+
+/*!
+    \ingroup Parm
+*/
+/*!
+    Turn recording of Parm changes for undo on or off. Turning recording off also clears the undo history. Long scripted
+    or batch sessions that set many Parms should turn recording off to keep the undo history from growing.
+    \forcpponly
+    \code{.cpp}
+    SetUndoFlag( false );
+
+    // Add Pod Geom
+    string pod_id = AddGeom( "POD", "" );
+
+    for ( int i = 0; i < 10; i++ )
+    {
+        SetParmValUpdate( pod_id, "Length", "Design", 10.0 + i );
+    }
+
+    SetUndoFlag( true );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    SetUndoFlag( False )
+
+    # Add Pod Geom
+    pod_id = AddGeom( "POD", "" )
+
+    for i in range( 10 ):
+        SetParmValUpdate( pod_id, "Length", "Design", 10.0 + i )
+
+    SetUndoFlag( True )
+
+    \endcode
+    \endPythonOnly
+    \sa GetUndoFlag
+    \param [in] flag True to record Parm changes for undo
+*/
+
+extern void SetUndoFlag( bool flag );
+
+/*!
+    \ingroup Parm
+*/
+/*!
+    Check if Parm changes are being recorded for undo
+    \forcpponly
+    \code{.cpp}
+    SetUndoFlag( false );
+
+    if ( GetUndoFlag() ) { Print( "---> Error: API SetUndoFlag " ); }
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    SetUndoFlag( False )
+
+    if GetUndoFlag(): print( "---> Error: API SetUndoFlag " )
+
+    \endcode
+    \endPythonOnly
+    \sa SetUndoFlag
+    \return True if Parm changes are recorded for undo
+*/
+
+extern bool GetUndoFlag();
+
+/*!
+    \ingroup Parm
+*/
+/*!
+    Start a group of Parm changes that Undo reverts as one step. Groups may nest; the changes are grouped until the
+    outermost EndUndoGroup call.
+    \forcpponly
+    \code{.cpp}
+    // Add Pod Geom
+    string pod_id = AddGeom( "POD", "" );
+
+    BeginUndoGroup();
+
+    SetParmValUpdate( pod_id, "Length", "Design", 12.0 );
+    SetParmValUpdate( pod_id, "FineRatio", "Design", 8.0 );
+
+    EndUndoGroup();
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    # Add Pod Geom
+    pod_id = AddGeom( "POD", "" )
+
+    BeginUndoGroup()
+
+    SetParmValUpdate( pod_id, "Length", "Design", 12.0 )
+    SetParmValUpdate( pod_id, "FineRatio", "Design", 8.0 )
+
+    EndUndoGroup()
+
+    \endcode
+    \endPythonOnly
+    \sa EndUndoGroup, SetUndoFlag
+*/
+
+extern void BeginUndoGroup();
+
+/*!
+    \ingroup Parm
+*/
+/*!
+    End a group of Parm changes started with BeginUndoGroup
+    \forcpponly
+    \code{.cpp}
+    BeginUndoGroup();
+
+    // Set several Parms with SetParmValUpdate
+
+    EndUndoGroup();
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    BeginUndoGroup()
+
+    # Set several Parms with SetParmValUpdate
+
+    EndUndoGroup()
+
+    \endcode
+    \endPythonOnly
+    \sa BeginUndoGroup
+*/
+
+extern void EndUndoGroup();
+
 /*!
     \ingroup Parm
 */
@@ -16362,6 +16676,132 @@ extern std::vector < vec3d > CompVecPnt01(const std::string &geom_id, const int
 
 extern std::vector < vec3d > CompVecNorm01(const std::string &geom_id, const int &surf_indx, const std::vector < double > &us, const std::vector < double > &ws);
 
+/*!
+    \ingroup SurfaceQuery
+*/
+/*!
+    Determine the 3D coordinate for each surface coordinate point in the input arrays. The
+    results are returned as separate X, Y and Z component vectors so no per-point vec3d objects are created.
+    Large inputs are evaluated on multiple threads.
+    \forcpponly
+    \code{.cpp}
+    // Add Pod Geom
+    string geom_id = AddGeom( "POD", "" );
+
+    int n = 5;
+
+    array<double> uvec, wvec;
+
+    uvec.resize( n );
+    wvec.resize( n );
+
+    for( int i = 0 ; i < n ; i++ )
+    {
+        uvec[i] = (i+1)*1.0/(n+1);
+
+        wvec[i] = (n-i)*1.0/(n+1);
+    }
+
+    array<double> xvec, yvec, zvec;
+
+    CompPntVec( geom_id, 0, uvec, wvec, xvec, yvec, zvec );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    # Add Pod Geom
+    geom_id = AddGeom( "POD", "" )
+
+    n = 5
+
+    uvec = [0]*n
+    wvec = [0]*n
+
+    for i in range(n):
+
+        uvec[i] = (i+1)*1.0/(n+1)
+
+        wvec[i] = (n-i)*1.0/(n+1)
+
+    xvec, yvec, zvec = CompPntVec( geom_id, 0, uvec, wvec )
+
+    \endcode
+    \endPythonOnly
+    \sa CompVecPnt01
+    \param [in] geom_id string Parent Geom ID
+    \param [in] surf_indx int Main surface index from the parent Geom
+    \param [in] us vector<double> Input vector of U (0 - 1) surface coordinates
+    \param [in] ws vector<double> Input vector of W (0 - 1) surface coordinates
+    \param [out] x_out_vec vector<double> Output vector of point X components
+    \param [out] y_out_vec vector<double> Output vector of point Y components
+    \param [out] z_out_vec vector<double> Output vector of point Z components
+*/
+
+extern void CompPntVec( const std::string &geom_id, const int &surf_indx, const std::vector < double > &us, const std::vector < double > &ws, std::vector < double > &x_out_vec, std::vector < double > &y_out_vec, std::vector < double > &z_out_vec );
+
+/*!
+    \ingroup SurfaceQuery
+*/
+/*!
+    Determine the surface normal vector for each surface coordinate point in the input arrays. The
+    results are returned as separate X, Y and Z component vectors so no per-point vec3d objects are created.
+    Large inputs are evaluated on multiple threads.
+    \forcpponly
+    \code{.cpp}
+    // Add Pod Geom
+    string geom_id = AddGeom( "POD", "" );
+
+    int n = 5;
+
+    array<double> uvec, wvec;
+
+    uvec.resize( n );
+    wvec.resize( n );
+
+    for( int i = 0 ; i < n ; i++ )
+    {
+        uvec[i] = (i+1)*1.0/(n+1);
+
+        wvec[i] = (n-i)*1.0/(n+1);
+    }
+
+    array<double> xvec, yvec, zvec;
+
+    CompNormVec( geom_id, 0, uvec, wvec, xvec, yvec, zvec );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    # Add Pod Geom
+    geom_id = AddGeom( "POD", "" )
+
+    n = 5
+
+    uvec = [0]*n
+    wvec = [0]*n
+
+    for i in range(n):
+
+        uvec[i] = (i+1)*1.0/(n+1)
+
+        wvec[i] = (n-i)*1.0/(n+1)
+
+    xvec, yvec, zvec = CompNormVec( geom_id, 0, uvec, wvec )
+
+    \endcode
+    \endPythonOnly
+    \sa CompVecNorm01
+    \param [in] geom_id string Parent Geom ID
+    \param [in] surf_indx int Main surface index from the parent Geom
+    \param [in] us vector<double> Input vector of U (0 - 1) surface coordinates
+    \param [in] ws vector<double> Input vector of W (0 - 1) surface coordinates
+    \param [out] x_out_vec vector<double> Output vector of normal X components
+    \param [out] y_out_vec vector<double> Output vector of normal Y components
+    \param [out] z_out_vec vector<double> Output vector of normal Z components
+*/
+
+extern void CompNormVec( const std::string &geom_id, const int &surf_indx, const std::vector < double > &us, const std::vector < double > &ws, std::vector < double > &x_out_vec, std::vector < double > &y_out_vec, std::vector < double > &z_out_vec );
+
 /*!
     \ingroup SurfaceQuery
 */
@@ -42,6 +42,9 @@ namespace std {
 %apply ( std::vector<double> &OUTPUT ) { std::vector < double > &l_out_vec };
 %apply ( std::vector<double> &OUTPUT ) { std::vector < double > &m_out_vec };
 %apply ( std::vector<double> &OUTPUT ) { std::vector < double > &n_out_vec };
+%apply ( std::vector<double> &OUTPUT ) { std::vector < double > &x_out_vec };
+%apply ( std::vector<double> &OUTPUT ) { std::vector < double > &y_out_vec };
+%apply ( std::vector<double> &OUTPUT ) { std::vector < double > &z_out_vec };
 
 /* Let's just grab the original header file here */
 %include "APIDefines.h"
@@ -13,11 +13,30 @@
 #include "APIErrorMgr.h"
 #include "StringUtil.h"
 #include "StlHelper.h"
+#include "VSP_Geom_API.h"
 
 #ifndef NOREGEXP
 #include <regex>
 #endif
 
+//===== Check For Whole Word In Code =====//
+static bool ContainsWord( const string & code, const string & word )
+{
+    std::string::size_type loc = code.find( word );
+    while ( loc != std::string::npos )
+    {
+        std::string::size_type end = loc + word.size();
+        bool start_ok = ( loc == 0 || !( isalnum( code[loc - 1] ) || code[loc - 1] == '_' ) );
+        bool end_ok = ( end >= code.size() || !( isalnum( code[end] ) || code[end] == '_' ) );
+        if ( start_ok && end_ok )
+        {
+            return true;
+        }
+        loc = code.find( word, loc + 1 );
+    }
+    return false;
+}
+
 //===== Encode Variable Def =====//
 xmlNodePtr VarDef::EncodeXml( xmlNodePtr & node )
 {
@@ -49,12 +68,33 @@ xmlNodePtr VarDef::DecodeXml( xmlNodePtr & var_node )
 AdvLink::AdvLink()
 {
     m_ValidScript = false;
+    m_UpdateFunc = NULL;
+    m_LinkFunc = NULL;
+    m_BindParmChanges = -1;
 }
 
 //==== Destructor ====//
 AdvLink::~AdvLink()
 {
+    ReleaseFuncs();
+}
 
+//==== Release Cached Script Functions ====//
+void AdvLink::ReleaseFuncs()
+{
+    if ( m_UpdateFunc )
+    {
+        m_UpdateFunc->Release();
+        m_UpdateFunc = NULL;
+    }
+    if ( m_LinkFunc )
+    {
+        m_LinkFunc->Release();
+        m_LinkFunc = NULL;
+    }
+    m_InputGlobals.clear();
+    m_OutputGlobals.clear();
+    m_BindParmChanges = -1;
 }
 
 bool AdvLink::ValidateParms()
@@ -170,6 +210,8 @@ void AdvLink::AddVar( const string & parm_id, const string & var_name, bool inpu
 
 void AdvLink::AddVar( const VarDef & pd, bool input_flag )
 {
+    m_BindParmChanges = -1;
+
     if ( input_flag )
         m_InputVars.push_back( pd );
     else
@@ -179,6 +221,8 @@ void AdvLink::AddVar( const VarDef & pd, bool input_flag )
 
 void AdvLink::DeleteVar( int index, bool input_flag )
 {
+    m_BindParmChanges = -1;
+
     if ( input_flag && index >= 0 && index < (int)m_InputVars.size() )
     {
         m_InputVars.erase( m_InputVars.begin() + index );
@@ -191,6 +235,8 @@ void AdvLink::DeleteVar( int index, bool input_flag )
 
 void AdvLink::DeleteAllVars( bool input_flag )
 {
+    m_BindParmChanges = -1;
+
     if ( input_flag )
     {
         m_InputVars.clear();
@@ -211,6 +257,7 @@ void AdvLink::UpdateInputVarName( int index, const string & var_name, bool chang
         }
 
         m_InputVars[ index ].m_VarName = var_name;
+        m_BindParmChanges = -1;
     }
 }
 
@@ -224,6 +271,7 @@ void AdvLink::UpdateOutputVarName( int index, const string & var_name, bool chan
         }
 
         m_OutputVars[ index ].m_VarName = var_name;
+        m_BindParmChanges = -1;
     }
 }
 
@@ -470,9 +518,25 @@ bool AdvLink::BuildScript()
     }
     script.append( "}\n\n" );
 
-    script.append( "void UpdateLink()\n{\n" );
-    script.append( "    LoadInput();\n\n" );
-    script.append( m_ScriptCode );
+    //==== Split Out Link Code So It Can Be Called Directly, Unless It Returns Early ====//
+    bool split_code = !ContainsWord( m_ScriptCode, "return" );
+
+    if ( split_code )
+    {
+        script.append( "int LinkCode()\n{\n" );
+        script.append( m_ScriptCode );
+        script.append( "\n    return 0;\n}\n\n" );
+
+        script.append( "void UpdateLink()\n{\n" );
+        script.append( "    LoadInput();\n\n" );
+        script.append( "    LinkCode();\n" );
+    }
+    else
+    {
+        script.append( "void UpdateLink()\n{\n" );
+        script.append( "    LoadInput();\n\n" );
+        script.append( m_ScriptCode );
+    }
     script.append( "\n    LoadOutput();\n" );
     script.append( "\n    Update();\n}\n" );
 
@@ -480,6 +544,11 @@ bool AdvLink::BuildScript()
 
     string module_name = "AdvLink_" + m_Name;
 
+    ReleaseFuncs();
+    m_NativeExpr.Clear();
+    m_BoundInNames = GetInputNames();
+    m_BoundOutNames = GetOutputNames();
+
     ScriptMgr.RemoveScript( module_name );
 
     ScriptMgr.ClearMessages();
@@ -505,10 +574,136 @@ bool AdvLink::BuildScript()
         return false;
     }
 
+    //==== Cache Function Handles And Global Addresses ====//
+    m_UpdateFunc = ScriptMgr.FindFunction( m_ScriptModule, "void UpdateLink()" );
+    if ( split_code )
+    {
+        m_LinkFunc = ScriptMgr.FindFunction( m_ScriptModule, "int LinkCode()" );
+
+        for ( int i = 0 ; i < (int)m_BoundInNames.size() ; i++ )
+        {
+            m_InputGlobals.push_back( ScriptMgr.FindGlobalDouble( m_ScriptModule, m_BoundInNames[i] ) );
+        }
+        for ( int i = 0 ; i < (int)m_BoundOutNames.size() ; i++ )
+        {
+            m_OutputGlobals.push_back( ScriptMgr.FindGlobalDouble( m_ScriptModule, m_BoundOutNames[i] ) );
+        }
+
+        //==== Plain Arithmetic Links Skip The Script Engine Entirely ====//
+        m_NativeExpr.Compile( m_ScriptCode, m_BoundInNames, m_BoundOutNames );
+    }
+
     m_ValidScript = true;
     return true;
 }
 
+//==== Resolve Parm Pointers For Script Variables ====//
+void AdvLink::BindVars()
+{
+    if ( m_BindParmChanges == ParmMgr.GetNumParmChanges() )
+    {
+        return;
+    }
+
+    // Same first-match-by-name lookup as GetVar/SetVar.
+    m_InputParms.assign( m_BoundInNames.size(), NULL );
+    for ( int i = 0 ; i < (int)m_BoundInNames.size() ; i++ )
+    {
+        for ( int j = 0 ; j < (int)m_InputVars.size() ; j++ )
+        {
+            if ( m_InputVars[j].m_VarName == m_BoundInNames[i] )
+            {
+                m_InputParms[i] = ParmMgr.FindParm( m_InputVars[j].m_ParmID );
+                break;
+            }
+        }
+    }
+
+    m_OutputParms.assign( m_BoundOutNames.size(), NULL );
+    for ( int i = 0 ; i < (int)m_BoundOutNames.size() ; i++ )
+    {
+        for ( int j = 0 ; j < (int)m_OutputVars.size() ; j++ )
+        {
+            if ( m_OutputVars[j].m_VarName == m_BoundOutNames[i] )
+            {
+                m_OutputParms[i] = ParmMgr.FindParm( m_OutputVars[j].m_ParmID );
+                break;
+            }
+        }
+    }
+
+    m_BindParmChanges = ParmMgr.GetNumParmChanges();
+}
+
+//==== Execute Link - Same Steps As Generated UpdateLink() ====//
+void AdvLink::RunLink()
+{
+    AdvLinkMgr.SetActiveLink( this );
+
+    if ( !m_UpdateFunc )
+    {
+        //==== Call Script ====//
+        ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+        return;
+    }
+
+    bool native_flag = m_NativeExpr.IsValid() && AdvLinkMgr.GetNativeExprFlag();
+
+    if ( !native_flag && !m_LinkFunc )
+    {
+        ScriptMgr.ExecuteFunction( m_UpdateFunc );
+        return;
+    }
+
+    BindVars();
+
+    //==== Load Input ====//
+    m_InputVals.resize( m_InputParms.size() );
+    for ( int i = 0 ; i < (int)m_InputParms.size() ; i++ )
+    {
+        m_InputVals[i] = m_InputParms[i] ? m_InputParms[i]->Get() : 0.0;
+    }
+
+    if ( native_flag )
+    {
+        m_NativeExpr.Eval( m_InputVals, m_OutputVals );
+    }
+    else
+    {
+        for ( int i = 0 ; i < (int)m_InputGlobals.size() ; i++ )
+        {
+            if ( m_InputGlobals[i] )
+            {
+                *m_InputGlobals[i] = m_InputVals[i];
+            }
+        }
+
+        if ( ScriptMgr.ExecuteFunction( m_LinkFunc ) != 0 )
+        {
+            return;
+        }
+
+        m_OutputVals.resize( m_OutputGlobals.size() );
+        for ( int i = 0 ; i < (int)m_OutputGlobals.size() ; i++ )
+        {
+            m_OutputVals[i] = m_OutputGlobals[i] ? *m_OutputGlobals[i] : -1.0e15;
+        }
+    }
+
+    //==== Load Output ====//
+    vector< double > out_vals = m_OutputVals;       // Copy - Setting Parms May Re-enter This Link
+    for ( int i = 0 ; i < (int)out_vals.size() && i < (int)m_OutputParms.size() ; i++ )
+    {
+        Parm* parm_ptr = m_OutputParms[i];
+        if ( parm_ptr && out_vals[i] > -1.0e15 && !parm_ptr->GetLinkUpdateFlag() )
+        {
+            parm_ptr->SetFromLink( out_vals[i] );
+        }
+    }
+
+    vsp::Update();
+}
+
 bool AdvLink::UpdateLink( const string & pid )
 {
     //==== Check Parm  ====//
@@ -527,20 +722,14 @@ bool AdvLink::UpdateLink( const string & pid )
     if ( !run_link )
         return false;
 
-    AdvLinkMgr.SetActiveLink( this );
-
-    //==== Call Script ====//
-    ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    RunLink();
 
     return true;
 }
 
 void AdvLink::ForceUpdate()
 {
-    AdvLinkMgr.SetActiveLink( this );
-
-    //==== Call Script ====//
-    ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    RunLink();
 }
 
 vector< string > AdvLink::GetInputNames()
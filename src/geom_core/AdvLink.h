@@ -18,9 +18,12 @@
 
 #include "Parm.h"
 #include "ParmContainer.h"
+#include "AdvLinkExpr.h"
 
 using std::string;
 
+class asIScriptFunction;
+
 class VarDef
 {
 public:
@@ -117,7 +120,26 @@ protected:
 
     bool m_ValidScript;
     string m_ScriptErrors;
-     
+
+    //==== Compiled Link - Avoids Name Lookups And Context Setup Per Update ====//
+    void RunLink();
+    void BindVars();
+    void ReleaseFuncs();
+
+    AdvLinkExpr m_NativeExpr;
+    asIScriptFunction* m_UpdateFunc;
+    asIScriptFunction* m_LinkFunc;
+
+    vector< string > m_BoundInNames;
+    vector< string > m_BoundOutNames;
+    vector< double* > m_InputGlobals;
+    vector< double* > m_OutputGlobals;
+    vector< Parm* > m_InputParms;
+    vector< Parm* > m_OutputParms;
+    vector< double > m_InputVals;
+    vector< double > m_OutputVals;
+    int m_BindParmChanges;
+
 private:
 
     //==== Cannot Copy Link Because Of Parm Registration With ParmMgr ====//
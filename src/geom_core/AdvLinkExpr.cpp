@@ -0,0 +1,615 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+// AdvLinkExpr.cpp: implementation of the native advanced link evaluator.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AdvLinkExpr.h"
+#include "Defines.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+//==== Math Functions Matching The Script Environment ====//
+static double ExprAbs( double x )               { return std::fabs( x ); }
+static double ExprRad2Deg( double r )           { return r * RAD_2_DEG; }
+static double ExprDeg2Rad( double d )           { return d * DEG_2_RAD; }
+static double ExprMin( double x, double y )     { return ( x < y ) ? x : y; }
+static double ExprMax( double x, double y )     { return ( x > y ) ? x : y; }
+static double ExprFraction( double x )          { return x - std::floor( x ); }
+
+struct ExprFunc1Def
+{
+    const char * m_Name;
+    double ( *m_Func )( double );
+};
+
+struct ExprFunc2Def
+{
+    const char * m_Name;
+    double ( *m_Func )( double, double );
+};
+
+static const ExprFunc1Def ExprFunc1Table[] =
+{
+    { "cos", std::cos }, { "sin", std::sin }, { "tan", std::tan },
+    { "acos", std::acos }, { "asin", std::asin }, { "atan", std::atan },
+    { "cosh", std::cosh }, { "sinh", std::sinh }, { "tanh", std::tanh },
+    { "log", std::log }, { "log10", std::log10 }, { "sqrt", std::sqrt },
+    { "ceil", std::ceil }, { "floor", std::floor }, { "abs", ExprAbs },
+    { "fraction", ExprFraction }, { "Rad2Deg", ExprRad2Deg }, { "Deg2Rad", ExprDeg2Rad },
+};
+
+static const ExprFunc2Def ExprFunc2Table[] =
+{
+    { "atan2", std::atan2 }, { "pow", std::pow }, { "Min", ExprMin }, { "Max", ExprMax },
+};
+
+//==== Constructor ====//
+AdvLinkExpr::AdvLinkExpr()
+{
+    m_Pos = 0;
+    m_NumIn = 0;
+    m_NumOut = 0;
+    m_Valid = false;
+}
+
+//==== Clear Compiled Program ====//
+void AdvLinkExpr::Clear()
+{
+    m_Tokens.clear();
+    m_Pos = 0;
+    m_SlotNames.clear();
+    m_Ops.clear();
+    m_Slots.clear();
+    m_Stack.clear();
+    m_NumIn = 0;
+    m_NumOut = 0;
+    m_Valid = false;
+}
+
+//==== Compile Link Code - Return False If Not Simple Arithmetic ====//
+bool AdvLinkExpr::Compile( const string & code, const vector< string > & in_names, const vector< string > & out_names )
+{
+    Clear();
+
+    m_NumIn = in_names.size();
+    m_NumOut = out_names.size();
+
+    m_SlotNames = in_names;
+    m_SlotNames.insert( m_SlotNames.end(), out_names.begin(), out_names.end() );
+
+    if ( !Tokenize( code ) )
+    {
+        Clear();
+        return false;
+    }
+
+    while ( Peek().m_Type != TOK_END )
+    {
+        if ( !ParseStatement() )
+        {
+            Clear();
+            return false;
+        }
+    }
+
+    //==== Outputs Start Untouched, Same As Script Globals ====//
+    m_Slots.assign( m_SlotNames.size(), 0.0 );
+    for ( int i = 0 ; i < m_NumOut ; i++ )
+    {
+        m_Slots[ m_NumIn + i ] = -1.0e15;
+    }
+
+    m_Valid = true;
+    return true;
+}
+
+//==== Run Compiled Program ====//
+void AdvLinkExpr::Eval( const vector< double > & in_vals, vector< double > & out_vals )
+{
+    if ( !m_Valid )
+    {
+        return;
+    }
+
+    for ( int i = 0 ; i < m_NumIn ; i++ )
+    {
+        m_Slots[i] = ( i < ( int )in_vals.size() ) ? in_vals[i] : 0.0;
+    }
+    for ( int i = m_NumIn + m_NumOut ; i < ( int )m_Slots.size() ; i++ )
+    {
+        m_Slots[i] = 0.0;
+    }
+
+    m_Stack.resize( m_Ops.size() + 1 );
+    double* sp = &m_Stack[0];
+
+    for ( int i = 0 ; i < ( int )m_Ops.size() ; i++ )
+    {
+        const ExprOp & op = m_Ops[i];
+        switch ( op.m_Op )
+        {
+        case OP_CONST:
+            *sp++ = op.m_Val;
+            break;
+        case OP_LOAD:
+            *sp++ = m_Slots[ op.m_Index ];
+            break;
+        case OP_STORE:
+            m_Slots[ op.m_Index ] = *--sp;
+            break;
+        case OP_ADD:
+            sp--;
+            sp[-1] += sp[0];
+            break;
+        case OP_SUB:
+            sp--;
+            sp[-1] -= sp[0];
+            break;
+        case OP_MUL:
+            sp--;
+            sp[-1] *= sp[0];
+            break;
+        case OP_DIV:
+            sp--;
+            sp[-1] /= sp[0];
+            break;
+        case OP_NEG:
+            sp[-1] = -sp[-1];
+            break;
+        case OP_FUNC1:
+            sp[-1] = op.m_F1( sp[-1] );
+            break;
+        case OP_FUNC2:
+            sp--;
+            sp[-1] = op.m_F2( sp[-1], sp[0] );
+            break;
+        }
+    }
+
+    out_vals.resize( m_NumOut );
+    for ( int i = 0 ; i < m_NumOut ; i++ )
+    {
+        out_vals[i] = m_Slots[ m_NumIn + i ];
+    }
+}
+
+//==== Split Code Into Tokens ====//
+bool AdvLinkExpr::Tokenize( const string & code )
+{
+    int n = code.size();
+    int i = 0;
+
+    while ( i < n )
+    {
+        char c = code[i];
+
+        if ( isspace( c ) )
+        {
+            i++;
+        }
+        else if ( c == '/' && i + 1 < n && code[i + 1] == '/' )
+        {
+            while ( i < n && code[i] != '\n' )
+            {
+                i++;
+            }
+        }
+        else if ( c == '/' && i + 1 < n && code[i + 1] == '*' )
+        {
+            size_t end = code.find( "*/", i + 2 );
+            if ( end == string::npos )
+            {
+                return false;
+            }
+            i = end + 2;
+        }
+        else if ( isdigit( c ) || ( c == '.' && i + 1 < n && isdigit( code[i + 1] ) ) )
+        {
+            int start = i;
+            bool is_int = true;
+            while ( i < n && isdigit( code[i] ) )
+            {
+                i++;
+            }
+            if ( i < n && code[i] == '.' )
+            {
+                is_int = false;
+                i++;
+                while ( i < n && isdigit( code[i] ) )
+                {
+                    i++;
+                }
+            }
+            if ( i < n && ( code[i] == 'e' || code[i] == 'E' ) )
+            {
+                is_int = false;
+                i++;
+                if ( i < n && ( code[i] == '+' || code[i] == '-' ) )
+                {
+                    i++;
+                }
+                if ( i >= n || !isdigit( code[i] ) )
+                {
+                    return false;
+                }
+                while ( i < n && isdigit( code[i] ) )
+                {
+                    i++;
+                }
+            }
+
+            // Suffixes ( 1.0f ), hex and the like are left to AngelScript.
+            if ( i < n && ( isalnum( code[i] ) || code[i] == '_' || code[i] == '.' ) )
+            {
+                return false;
+            }
+
+            Token t;
+            t.m_Type = is_int ? TOK_INT : TOK_NUM;
+            t.m_Text = code.substr( start, i - start );
+            t.m_Val = atof( t.m_Text.c_str() );
+            m_Tokens.push_back( t );
+        }
+        else if ( isalpha( c ) || c == '_' )
+        {
+            int start = i;
+            while ( i < n && ( isalnum( code[i] ) || code[i] == '_' ) )
+            {
+                i++;
+            }
+
+            Token t;
+            t.m_Type = TOK_IDENT;
+            t.m_Text = code.substr( start, i - start );
+            t.m_Val = 0.0;
+            m_Tokens.push_back( t );
+        }
+        else
+        {
+            Token t;
+            t.m_Type = TOK_OP;
+            t.m_Val = 0.0;
+
+            // Two character operators are kept whole so they can't be misread.
+            static const char * two_char_ops[] = { "+=", "-=", "*=", "/=", "**", "==", "!=", "<=", ">=", "&&", "||", "++", "--", "::" };
+            for ( int k = 0 ; k < ( int )( sizeof( two_char_ops ) / sizeof( two_char_ops[0] ) ) ; k++ )
+            {
+                if ( code.compare( i, 2, two_char_ops[k] ) == 0 )
+                {
+                    t.m_Text = two_char_ops[k];
+                    break;
+                }
+            }
+            if ( t.m_Text.empty() )
+            {
+                t.m_Text = string( 1, c );
+            }
+
+            i += t.m_Text.size();
+            m_Tokens.push_back( t );
+        }
+    }
+
+    Token t;
+    t.m_Type = TOK_END;
+    t.m_Val = 0.0;
+    m_Tokens.push_back( t );
+
+    return true;
+}
+
+const AdvLinkExpr::Token & AdvLinkExpr::Peek( int ahead )
+{
+    int i = m_Pos + ahead;
+    if ( i >= ( int )m_Tokens.size() )
+    {
+        i = m_Tokens.size() - 1;
+    }
+    return m_Tokens[i];
+}
+
+bool AdvLinkExpr::Accept( const string & op )
+{
+    const Token & t = Peek();
+    if ( t.m_Type == TOK_OP && t.m_Text == op )
+    {
+        m_Pos++;
+        return true;
+    }
+    return false;
+}
+
+void AdvLinkExpr::AddOp( int op, int index, double val, Func1Ptr f1, Func2Ptr f2 )
+{
+    ExprOp e;
+    e.m_Op = op;
+    e.m_Index = index;
+    e.m_Val = val;
+    e.m_F1 = f1;
+    e.m_F2 = f2;
+    m_Ops.push_back( e );
+}
+
+int AdvLinkExpr::FindSlot( const string & name )
+{
+    for ( int i = 0 ; i < ( int )m_SlotNames.size() ; i++ )
+    {
+        if ( m_SlotNames[i] == name )
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//==== Statement: [const] double a = expr, b = expr;  or  a (op)= expr; ====//
+bool AdvLinkExpr::ParseStatement()
+{
+    if ( Accept( ";" ) )
+    {
+        return true;
+    }
+
+    bool decl = false;
+    if ( Peek().m_Type == TOK_IDENT && Peek().m_Text == "const" )
+    {
+        m_Pos++;
+        if ( !( Peek().m_Type == TOK_IDENT && Peek().m_Text == "double" ) )
+        {
+            return false;
+        }
+    }
+    if ( Peek().m_Type == TOK_IDENT && Peek().m_Text == "double" )
+    {
+        m_Pos++;
+        decl = true;
+    }
+
+    while ( true )
+    {
+        if ( Peek().m_Type != TOK_IDENT )
+        {
+            return false;
+        }
+        string name = Peek().m_Text;
+        m_Pos++;
+
+        int slot = FindSlot( name );
+        if ( decl )
+        {
+            if ( slot >= 0 )
+            {
+                return false;           // Shadowing a link variable, leave it to AngelScript.
+            }
+            m_SlotNames.push_back( name );
+            slot = m_SlotNames.size() - 1;
+        }
+        else if ( slot < 0 )
+        {
+            return false;
+        }
+
+        bool is_int;
+        if ( Accept( "=" ) )
+        {
+            if ( !ParseExpr( is_int ) )
+            {
+                return false;
+            }
+        }
+        else if ( decl )
+        {
+            AddOp( OP_CONST, 0, 0.0 );
+        }
+        else
+        {
+            int op;
+            if ( Accept( "+=" ) )
+            {
+                op = OP_ADD;
+            }
+            else if ( Accept( "-=" ) )
+            {
+                op = OP_SUB;
+            }
+            else if ( Accept( "*=" ) )
+            {
+                op = OP_MUL;
+            }
+            else if ( Accept( "/=" ) )
+            {
+                op = OP_DIV;
+            }
+            else
+            {
+                return false;
+            }
+
+            AddOp( OP_LOAD, slot );
+            if ( !ParseExpr( is_int ) )
+            {
+                return false;
+            }
+            AddOp( op );
+        }
+
+        AddOp( OP_STORE, slot );
+
+        if ( decl && Accept( "," ) )
+        {
+            continue;
+        }
+        return Accept( ";" );
+    }
+}
+
+//==== Expr: Term { ( + | - ) Term } ====//
+bool AdvLinkExpr::ParseExpr( bool & is_int )
+{
+    if ( !ParseTerm( is_int ) )
+    {
+        return false;
+    }
+
+    while ( true )
+    {
+        int op;
+        if ( Accept( "+" ) )
+        {
+            op = OP_ADD;
+        }
+        else if ( Accept( "-" ) )
+        {
+            op = OP_SUB;
+        }
+        else
+        {
+            return true;
+        }
+
+        bool rhs_int;
+        if ( !ParseTerm( rhs_int ) )
+        {
+            return false;
+        }
+        AddOp( op );
+        is_int = is_int && rhs_int;
+    }
+}
+
+//==== Term: Unary { ( * | / ) Unary } ====//
+bool AdvLinkExpr::ParseTerm( bool & is_int )
+{
+    if ( !ParseUnary( is_int ) )
+    {
+        return false;
+    }
+
+    while ( true )
+    {
+        int op;
+        if ( Accept( "*" ) )
+        {
+            op = OP_MUL;
+        }
+        else if ( Accept( "/" ) )
+        {
+            op = OP_DIV;
+        }
+        else
+        {
+            return true;
+        }
+
+        bool rhs_int;
+        if ( !ParseUnary( rhs_int ) )
+        {
+            return false;
+        }
+
+        // Integer division truncates in AngelScript, leave it to the script.
+        if ( op == OP_DIV && is_int && rhs_int )
+        {
+            return false;
+        }
+
+        AddOp( op );
+        is_int = is_int && rhs_int;
+    }
+}
+
+//==== Unary: ( - | + ) Unary | Primary ====//
+bool AdvLinkExpr::ParseUnary( bool & is_int )
+{
+    if ( Accept( "-" ) )
+    {
+        if ( !ParseUnary( is_int ) )
+        {
+            return false;
+        }
+        AddOp( OP_NEG );
+        return true;
+    }
+    if ( Accept( "+" ) )
+    {
+        return ParseUnary( is_int );
+    }
+    return ParsePrimary( is_int );
+}
+
+//==== Primary: Number | Var | Func( Args ) | ( Expr ) ====//
+bool AdvLinkExpr::ParsePrimary( bool & is_int )
+{
+    const Token t = Peek();
+
+    if ( t.m_Type == TOK_NUM || t.m_Type == TOK_INT )
+    {
+        m_Pos++;
+        AddOp( OP_CONST, 0, t.m_Val );
+        is_int = ( t.m_Type == TOK_INT );
+        return true;
+    }
+
+    if ( Accept( "(" ) )
+    {
+        if ( !ParseExpr( is_int ) )
+        {
+            return false;
+        }
+        return Accept( ")" );
+    }
+
+    if ( t.m_Type != TOK_IDENT )
+    {
+        return false;
+    }
+    m_Pos++;
+    is_int = false;
+
+    if ( !Accept( "(" ) )
+    {
+        int slot = FindSlot( t.m_Text );
+        if ( slot < 0 )
+        {
+            return false;
+        }
+        AddOp( OP_LOAD, slot );
+        return true;
+    }
+
+    //==== Function Call ====//
+    bool arg_int;
+    for ( int i = 0 ; i < ( int )( sizeof( ExprFunc1Table ) / sizeof( ExprFunc1Table[0] ) ) ; i++ )
+    {
+        if ( t.m_Text == ExprFunc1Table[i].m_Name )
+        {
+            if ( !ParseExpr( arg_int ) || !Accept( ")" ) )
+            {
+                return false;
+            }
+            AddOp( OP_FUNC1, 0, 0.0, ExprFunc1Table[i].m_Func );
+            return true;
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )( sizeof( ExprFunc2Table ) / sizeof( ExprFunc2Table[0] ) ) ; i++ )
+    {
+        if ( t.m_Text == ExprFunc2Table[i].m_Name )
+        {
+            if ( !ParseExpr( arg_int ) || !Accept( "," ) || !ParseExpr( arg_int ) || !Accept( ")" ) )
+            {
+                return false;
+            }
+            AddOp( OP_FUNC2, 0, 0.0, NULL, ExprFunc2Table[i].m_Func );
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,87 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// AdvLinkExpr.h: Native evaluator for simple arithmetic advanced link code
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_ADVLINKEXPR__INCLUDED_)
+#define VSP_ADVLINKEXPR__INCLUDED_
+
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+//==== Compiled Advanced Link Expression ====//
+// Compiles link code made only of assignments of arithmetic expressions
+// ( + - * / unary -, parentheses, numeric literals, link variables, local
+// doubles and the common math functions ) into a flat stack program.
+// Anything else fails to compile and the link falls back to AngelScript.
+class AdvLinkExpr
+{
+public:
+    AdvLinkExpr();
+    virtual ~AdvLinkExpr()                                          {}
+
+    bool Compile( const string & code, const vector< string > & in_names, const vector< string > & out_names );
+    void Clear();
+
+    bool IsValid() const                                            { return m_Valid; }
+
+    // Outputs hold their value between evaluations, like the script globals.
+    void Eval( const vector< double > & in_vals, vector< double > & out_vals );
+
+protected:
+
+    enum { OP_CONST, OP_LOAD, OP_STORE, OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_NEG, OP_FUNC1, OP_FUNC2 };
+
+    typedef double ( *Func1Ptr )( double );
+    typedef double ( *Func2Ptr )( double, double );
+
+    struct ExprOp
+    {
+        int m_Op;
+        int m_Index;
+        double m_Val;
+        Func1Ptr m_F1;
+        Func2Ptr m_F2;
+    };
+
+    enum { TOK_END, TOK_NUM, TOK_INT, TOK_IDENT, TOK_OP };
+
+    struct Token
+    {
+        int m_Type;
+        string m_Text;
+        double m_Val;
+    };
+
+    bool Tokenize( const string & code );
+    bool ParseStatement();
+    bool ParseExpr( bool & is_int );
+    bool ParseTerm( bool & is_int );
+    bool ParseUnary( bool & is_int );
+    bool ParsePrimary( bool & is_int );
+
+    int FindSlot( const string & name );
+    const Token & Peek( int ahead = 0 );
+    bool Accept( const string & op );
+    void AddOp( int op, int index = 0, double val = 0.0, Func1Ptr f1 = NULL, Func2Ptr f2 = NULL );
+
+    vector< Token > m_Tokens;
+    int m_Pos;
+
+    vector< string > m_SlotNames;
+    vector< ExprOp > m_Ops;
+    vector< double > m_Slots;
+    vector< double > m_Stack;
+    int m_NumIn;
+    int m_NumOut;
+    bool m_Valid;
+};
+
+#endif // !defined(VSP_ADVLINKEXPR__INCLUDED_)
@@ -18,6 +18,7 @@ AdvLinkMgrSingleton::AdvLinkMgrSingleton()
 {
     m_ActiveLink = NULL;
     m_EditLinkIndex = 0;
+    m_NativeExprFlag = true;
 
 }
 
@@ -295,10 +296,10 @@ xmlNodePtr AdvLinkMgrSingleton::DecodeXml( xmlNodePtr & node )
     xmlNodePtr linkmgr_node = XmlUtil::GetNode( node, "AdvLinkMgr", 0 );
     if ( linkmgr_node )
     {
-        int num = XmlUtil::GetNumNames( linkmgr_node, "AdvLink" );
-        for ( int i = 0 ; i < num ; i++ )
+        vector< xmlNodePtr > link_nodes = XmlUtil::GetNodeVec( linkmgr_node, "AdvLink" );
+        for ( int i = 0 ; i < ( int )link_nodes.size() ; i++ )
         {
-            xmlNodePtr link_node = XmlUtil::GetNode( linkmgr_node, "AdvLink", i );
+            xmlNodePtr link_node = link_nodes[i];
             if ( link_node )
             {
                 AdvLink* link = AddLink( "" );
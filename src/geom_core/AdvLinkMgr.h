@@ -52,6 +52,10 @@ public:
     void ForceUpdate( );
     void SetActiveLink( AdvLink* adv_link )                             { m_ActiveLink = adv_link; }
 
+    //==== Evaluate Simple Arithmetic Links Without AngelScript ====//
+    void SetNativeExprFlag( bool flag )                                 { m_NativeExprFlag = flag; }
+    bool GetNativeExprFlag()                                            { return m_NativeExprFlag; }
+
     AdvLink* GetLink( int index );
     int GetLinkIndex( const string & name );
     void SetEditLinkIndex( int index )                                  { m_EditLinkIndex = index; }
@@ -74,6 +78,7 @@ private:
     void AddInputOutput( const string & parm_id, const string & var_name, bool input_flag );
     int m_EditLinkIndex;
     AdvLink* m_ActiveLink;
+    bool m_NativeExprFlag;
     vector< AdvLink* > m_LinkVec;
 
 };
@@ -20,6 +20,8 @@
 #include "VSPAEROMgr.h"
 #include "ParasiteDragMgr.h"
 #include <cstdio>
+#include <chrono>
+#include <thread>
 
 #include "VSP_Geom_API.h"
 
@@ -35,6 +37,7 @@ void RWCollection::Clear()
 //==== Constructor ====//
 AnalysisMgrSingleton::AnalysisMgrSingleton()
 {
+    m_AnalysisExecutionDuration = 0.0;
 }
 //==== Destructor ====//
 AnalysisMgrSingleton::~AnalysisMgrSingleton()
@@ -156,6 +159,69 @@ string AnalysisMgrSingleton::ExecAnalysis( const string & analysis )
     return res;
 }
 
+//==== Execute Analyses In Order, Each Run Of Read-Only Analyses Side By Side ====//
+vector < string > AnalysisMgrSingleton::ExecAnalyses( const vector < string > & analyses )
+{
+    int n = analyses.size();
+    vector < string > res_vec( n );
+
+    int i = 0;
+    while ( i < n )
+    {
+        Analysis *analysis_ptr = FindAnalysis( analyses[i] );
+
+        if ( !analysis_ptr || !analysis_ptr->IsReadOnly() )
+        {
+            res_vec[i] = ExecAnalysis( analyses[i] );
+            i++;
+            continue;
+        }
+
+        // Analyses that change the Vehicle end the run, so later ones see their changes
+        vector < Analysis* > run_vec;
+        while ( i + ( int )run_vec.size() < n )
+        {
+            analysis_ptr = FindAnalysis( analyses[ i + run_vec.size() ] );
+            if ( !analysis_ptr || !analysis_ptr->IsReadOnly() )
+            {
+                break;
+            }
+            run_vec.push_back( analysis_ptr );
+        }
+
+        // Wall time, std::clock would sum the CPU time of every thread
+        int nrun = run_vec.size();
+        vector < double > duration_vec( nrun );
+        vector < std::thread > threads;
+        threads.reserve( nrun );
+        for ( int j = 0 ; j < nrun ; j++ )
+        {
+            threads.emplace_back( [ &, j ]()
+            {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                res_vec[ i + j ] = run_vec[j]->Execute();
+                duration_vec[j] = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+            } );
+        }
+
+        for ( int j = 0 ; j < nrun ; j++ )
+        {
+            threads[j].join();
+
+            Results* res_ptr = ResultsMgr.FindResultsPtr( res_vec[ i + j ] );
+            if ( res_ptr )
+            {
+                res_ptr->Add( NameValData( "Analysis_Duration_Sec", duration_vec[j], "Time to execute analysis in seconds." ) );
+            }
+        }
+
+        m_AnalysisExecutionDuration = duration_vec.back();
+        i += nrun;
+    }
+
+    return res_vec;
+}
+
 bool AnalysisMgrSingleton::ValidAnalysisName( const string & analysis )
 {
     Analysis* analysis_ptr = FindAnalysis( analysis );
@@ -47,6 +47,13 @@ public:
     virtual void SetDefaults() = 0;
     virtual string Execute() = 0;
 
+    // True for analyses that only read the Vehicle and create Results, these
+    // may run alongside each other in ExecAnalyses.
+    virtual bool IsReadOnly() const
+    {
+        return false;
+    }
+
     RWCollection m_Inputs;
 
 };
@@ -73,6 +80,7 @@ public:
     bool RegisterAnalysis( Analysis* asys );
 
     string ExecAnalysis( const string & analysis );
+    vector < string > ExecAnalyses( const vector < string > & analyses );
 
     bool ValidAnalysisName( const string & analysis );
     bool ValidAnalysisInputDataIndex( const string & analysis, const string & name, int index = 0 );
@@ -137,6 +145,11 @@ public:
     virtual void SetDefaults();
     virtual string Execute();
 
+    virtual bool IsReadOnly() const
+    {
+        return true;
+    }
+
 };
 
 class CompGeomAnalysis : public Analysis
@@ -169,6 +182,11 @@ public:
     virtual void SetDefaults();
     virtual string Execute();
 
+    virtual bool IsReadOnly() const
+    {
+        return true;
+    }
+
 };
 
 class MassPropAnalysis : public Analysis
@@ -212,6 +230,11 @@ public:
 
     virtual void SetDefaults();
     virtual string Execute();
+
+    virtual bool IsReadOnly() const
+    {
+        return true;
+    }
 };
 
 class WaveDragAnalysis : public Analysis
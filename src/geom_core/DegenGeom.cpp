@@ -891,41 +891,48 @@ void DegenGeom::addDegenHingeLine( SSControlSurf *csurf, int surfIndx )
     }
 }
 
-string DegenGeom::makeCsvFmt( int n, bool newline )
+//==== Row Format Strings, Built Once And Shared By All Writers ====//
+const string & DegenGeom::makeCsvFmt( int n, bool newline )
 {
-    char fmt[10];
-    snprintf( fmt, sizeof( fmt ), "%%.%de", DBL_DIG + 3 );
-
-    string fmtstring = "";
-    for( int i = 0; i < n; ++i )
+    static const int nmax = 32;
+    static const vector< string > fmt_table = []()
     {
-        fmtstring.append( fmt );
-        if( i < n - 1 )
-        {
-            fmtstring.append( ", " );
-        }
-        else
+        char fmt[10];
+        snprintf( fmt, sizeof( fmt ), "%%.%de", DBL_DIG + 3 );
+
+        vector< string > table( 2 * nmax );
+        for ( int k = 0; k < nmax; k++ )
         {
-            if( newline )
+            string fmtstring = "";
+            for( int i = 0; i < k; ++i )
             {
-                fmtstring.append( "\n" );
+                fmtstring.append( fmt );
+                if( i < k - 1 )
+                {
+                    fmtstring.append( ", " );
+                }
             }
+            table[ 2 * k ] = fmtstring;
+            table[ 2 * k + 1 ] = fmtstring + "\n";
         }
-    }
-    return fmtstring;
+        return table;
+    }();
+
+    assert( n >= 0 && n < nmax );
+    return fmt_table[ 2 * n + ( newline ? 1 : 0 ) ];
 }
 
-void DegenGeom::write_degenGeomSurfCsv_file( FILE* file_id, int nxsecs )
+void DegenGeom::write_degenGeomSurfCsv_file( TextBuffer &buf, int nxsecs )
 {
-    fprintf( file_id, "# DegenGeom Type,nXsecs, nPnts/Xsec\n" );
-    fprintf( file_id, "SURFACE_NODE,%d,%d\n", nxsecs, num_pnts );
-    fprintf( file_id, "# x,y,z,u,w\n" );
+    buf.Printf( "# DegenGeom Type,nXsecs, nPnts/Xsec\n" );
+    buf.Printf( "SURFACE_NODE,%d,%d\n", nxsecs, num_pnts );
+    buf.Printf( "# x,y,z,u,w\n" );
 
     for ( int i = 0; i < nxsecs; i++ )
     {
         for ( int j = 0; j < num_pnts; j++ )
         {
-            fprintf( file_id, makeCsvFmt( 5 ).c_str(),         \
+            buf.Printf( makeCsvFmt( 5 ).c_str(),         \
                      degenSurface.x[i][j].x(),       \
                      degenSurface.x[i][j].y(),       \
                      degenSurface.x[i][j].z(),       \
@@ -934,14 +941,14 @@ void DegenGeom::write_degenGeomSurfCsv_file( FILE* file_id, int nxsecs )
         }
     }
 
-    fprintf( file_id, "SURFACE_FACE,%d,%d\n", nxsecs - 1, num_pnts - 1 );
-    fprintf( file_id, "# nx,ny,nz,area\n" );
+    buf.Printf( "SURFACE_FACE,%d,%d\n", nxsecs - 1, num_pnts - 1 );
+    buf.Printf( "# nx,ny,nz,area\n" );
 
     for ( int i = 0; i < nxsecs - 1; i++ )
     {
         for ( int j = 0; j < num_pnts - 1; j++ )
         {
-            fprintf( file_id, makeCsvFmt( 4 ).c_str(),         \
+            buf.Printf( makeCsvFmt( 4 ).c_str(),         \
                      degenSurface.nvec[i][j].x(),    \
                      degenSurface.nvec[i][j].y(),    \
                      degenSurface.nvec[i][j].z(),    \
@@ -950,24 +957,24 @@ void DegenGeom::write_degenGeomSurfCsv_file( FILE* file_id, int nxsecs )
     }
 }
 
-void DegenGeom::write_degenGeomPlateCsv_file( FILE* file_id, int nxsecs, DegenPlate &degenPlate )
+void DegenGeom::write_degenGeomPlateCsv_file( TextBuffer &buf, int nxsecs, DegenPlate &degenPlate )
 {
-    fprintf( file_id, "# DegenGeom Type,nXsecs,nPnts/Xsec\n" );
-    fprintf( file_id, "PLATE,%d,%d\n", nxsecs, ( num_pnts + 1 ) / 2 );
-    fprintf( file_id, "# nx,ny,nz\n" );
+    buf.Printf( "# DegenGeom Type,nXsecs,nPnts/Xsec\n" );
+    buf.Printf( "PLATE,%d,%d\n", nxsecs, ( num_pnts + 1 ) / 2 );
+    buf.Printf( "# nx,ny,nz\n" );
     for ( int i = 0; i < nxsecs; i++ )
     {
-        fprintf( file_id, makeCsvFmt( 3 ).c_str(), degenPlate.nPlate[i].x(), \
+        buf.Printf( makeCsvFmt( 3 ).c_str(), degenPlate.nPlate[i].x(), \
                  degenPlate.nPlate[i].y(), \
                  degenPlate.nPlate[i].z()  );
     }
 
-    fprintf( file_id, "# x,y,z,zCamber,t,nCamberx,nCambery,nCamberz,u,wTop,wBot,xxCamber,xyCamber,xzCamber\n" );
+    buf.Printf( "# x,y,z,zCamber,t,nCamberx,nCambery,nCamberz,u,wTop,wBot,xxCamber,xyCamber,xzCamber\n" );
     for ( int i = 0; i < nxsecs; i++ )
     {
         for ( int j = 0; j < ( num_pnts + 1 ) / 2; j++ )
         {
-            fprintf( file_id, makeCsvFmt( 14 ).c_str(),    \
+            buf.Printf( makeCsvFmt( 14 ).c_str(),    \
                      degenPlate.x[i][j].x(),             \
                      degenPlate.x[i][j].y(),             \
                      degenPlate.x[i][j].z(),             \
@@ -986,22 +993,22 @@ void DegenGeom::write_degenGeomPlateCsv_file( FILE* file_id, int nxsecs, DegenPl
     }
 }
 
-void DegenGeom::write_degenGeomStickCsv_file( FILE* file_id, int nxsecs, DegenStick &degenStick )
+void DegenGeom::write_degenGeomStickCsv_file( TextBuffer &buf, int nxsecs, DegenStick &degenStick )
 {
 
-    fprintf( file_id, "# DegenGeom Type, nXsecs\n" );
-    fprintf( file_id, "STICK_NODE, %d\n", nxsecs );
-    fprintf( file_id, "# lex,ley,lez,tex,tey,tez,cgShellx,cgShelly,cgShellz,"
+    buf.Printf( "# DegenGeom Type, nXsecs\n" );
+    buf.Printf( "STICK_NODE, %d\n", nxsecs );
+    buf.Printf( "# lex,ley,lez,tex,tey,tez,cgShellx,cgShelly,cgShellz,"
              "cgSolidx,cgSolidy,cgSolidz,toc,tLoc,chord,Ishell11,Ishell22,"
              "Ishell12,Isolid11,Isolid22,Isolid12,sectArea,sectNormalx,"
              "sectNormaly,sectNormalz,perimTop,perimBot,u," );
-    fprintf( file_id, "t00,t01,t02,t03,t10,t11,t12,t13,t20,t21,t22,t23,t30,t31,t32,t33," );
-    fprintf( file_id, "it00,it01,it02,it03,it10,it11,it12,it13,it20,it21,it22,it23,it30,it31,it32,it33," );
-    fprintf( file_id, "toc2,tLoc2,anglele,anglete,radleTop,radleBot,\n" );
+    buf.Printf( "t00,t01,t02,t03,t10,t11,t12,t13,t20,t21,t22,t23,t30,t31,t32,t33," );
+    buf.Printf( "it00,it01,it02,it03,it10,it11,it12,it13,it20,it21,it22,it23,it30,it31,it32,it33," );
+    buf.Printf( "toc2,tLoc2,anglele,anglete,radleTop,radleBot,\n" );
 
     for ( int i = 0; i < nxsecs; i++ )
     {
-        fprintf( file_id, makeCsvFmt( 28, false ).c_str(), \
+        buf.Printf( makeCsvFmt( 28, false ).c_str(), \
                  degenStick.xle[i].x(),                  \
                  degenStick.xle[i].y(),                  \
                  degenStick.xle[i].z(),                  \
@@ -1031,22 +1038,22 @@ void DegenGeom::write_degenGeomStickCsv_file( FILE* file_id, int nxsecs, DegenSt
                  degenStick.perimBot[i],                 \
                  degenStick.u[i]                     );
 
-        fprintf( file_id, ", " );
+        buf.Printf( ", " );
 
         for( int j = 0; j < 16; j ++ )
         {
-            fprintf( file_id, makeCsvFmt( 1, false ).c_str(), degenStick.transmat[i][j] );
-            fprintf( file_id, ", " );
+            buf.Printf( makeCsvFmt( 1, false ).c_str(), degenStick.transmat[i][j] );
+            buf.Printf( ", " );
         }
 
 
         for( int j = 0; j < 16; j ++ )
         {
-            fprintf( file_id, makeCsvFmt( 1, false ).c_str(), degenStick.invtransmat[i][j] );
-            fprintf( file_id, ", " );
+            buf.Printf( makeCsvFmt( 1, false ).c_str(), degenStick.invtransmat[i][j] );
+            buf.Printf( ", " );
         }
 
-        fprintf( file_id, makeCsvFmt( 6, false ).c_str(), \
+        buf.Printf( makeCsvFmt( 6, false ).c_str(), \
                  degenStick.toc2[i],                      \
                  degenStick.tLoc2[i],                     \
                  degenStick.anglele[i],                   \
@@ -1054,17 +1061,17 @@ void DegenGeom::write_degenGeomStickCsv_file( FILE* file_id, int nxsecs, DegenSt
                  degenStick.radleTop[i],                  \
                  degenStick.radleBot[i]              );
 
-        fprintf( file_id, "\n" );
+        buf.Printf( "\n" );
     }
 
 
-    fprintf( file_id, "# DegenGeom Type, nXsecs\n" );
-    fprintf( file_id, "STICK_FACE, %d\n", nxsecs - 1 );
-    fprintf( file_id, "# sweeple,sweepte,areaTop,areaBot\n" );
+    buf.Printf( "# DegenGeom Type, nXsecs\n" );
+    buf.Printf( "STICK_FACE, %d\n", nxsecs - 1 );
+    buf.Printf( "# sweeple,sweepte,areaTop,areaBot\n" );
 
     for ( int i = 0; i < nxsecs - 1; i++ )
     {
-        fprintf( file_id, makeCsvFmt( 4 ).c_str(), \
+        buf.Printf( makeCsvFmt( 4 ).c_str(), \
                  degenStick.sweeple[i],                  \
                  degenStick.sweepte[i],                  \
                  degenStick.areaTop[i],                  \
@@ -1072,14 +1079,14 @@ void DegenGeom::write_degenGeomStickCsv_file( FILE* file_id, int nxsecs, DegenSt
     }
 }
 
-void DegenGeom::write_degenGeomPointCsv_file( FILE* file_id )
+void DegenGeom::write_degenGeomPointCsv_file( TextBuffer &buf )
 {
-    fprintf( file_id, "# DegenGeom Type\n" );
-    fprintf( file_id, "POINT\n" );
-    fprintf( file_id, "# vol,volWet,area,areaWet,Ishellxx,Ishellyy,Ishellzz,Ishellxy," );
-    fprintf( file_id, "Ishellxz,Ishellyz,Isolidxx,Isolidyy,Isolidzz,Isolidxy,Isolidxz," );
-    fprintf( file_id, "Isolidyz,cgShellx,cgShelly,cgShellz,cgSolidx,cgSolidy,cgSolidz\n" );
-    fprintf( file_id, makeCsvFmt( 22 ).c_str(), \
+    buf.Printf( "# DegenGeom Type\n" );
+    buf.Printf( "POINT\n" );
+    buf.Printf( "# vol,volWet,area,areaWet,Ishellxx,Ishellyy,Ishellzz,Ishellxy," );
+    buf.Printf( "Ishellxz,Ishellyz,Isolidxx,Isolidyy,Isolidzz,Isolidxy,Isolidxz," );
+    buf.Printf( "Isolidyz,cgShellx,cgShelly,cgShellz,cgSolidx,cgSolidy,cgSolidz\n" );
+    buf.Printf( makeCsvFmt( 22 ).c_str(), \
              degenPoint.vol[0],          \
              degenPoint.volWet[0],       \
              degenPoint.area[0],         \
@@ -1104,15 +1111,15 @@ void DegenGeom::write_degenGeomPointCsv_file( FILE* file_id )
              degenPoint.xcgSolid[0].z()  );
 }
 
-void DegenGeom::write_degenGeomDiskCsv_file( FILE* file_id )
+void DegenGeom::write_degenGeomDiskCsv_file( TextBuffer &buf )
 {
     char fmtstr[255];
     fmtstr[0] = '\0';
     strcat( fmtstr, makeCsvFmt( 7 ).c_str() );
-    fprintf( file_id, "# DegenGeom Type\n" );
-    fprintf( file_id, "PROP\n" );
-    fprintf( file_id, "# diameter,x,y,z,nx,ny,nz\n" );
-    fprintf( file_id, fmtstr, \
+    buf.Printf( "# DegenGeom Type\n" );
+    buf.Printf( "PROP\n" );
+    buf.Printf( "# diameter,x,y,z,nx,ny,nz\n" );
+    buf.Printf( fmtstr, \
              degenDisk.d,        \
              degenDisk.x.x(),    \
              degenDisk.x.y(),    \
@@ -1122,28 +1129,28 @@ void DegenGeom::write_degenGeomDiskCsv_file( FILE* file_id )
              degenDisk.nvec.z()  );
 }
 
-void DegenGeom::write_degenSubSurfCsv_file( FILE* file_id, int isubsurf )
+void DegenGeom::write_degenSubSurfCsv_file( TextBuffer &buf, int isubsurf )
 {
     string nospacename = degenSubSurfs[isubsurf].fullName;
     StringUtil::change_space_to_underscore( nospacename );
-    fprintf( file_id, "# DegenGeom Type, name, typeName, typeId, fullname\n" );
-    fprintf( file_id, "SUBSURF,%s,%s,%d,%s\n", degenSubSurfs[isubsurf].name.c_str(),
+    buf.Printf( "# DegenGeom Type, name, typeName, typeId, fullname\n" );
+    buf.Printf( "SUBSURF,%s,%s,%d,%s\n", degenSubSurfs[isubsurf].name.c_str(),
                                                degenSubSurfs[isubsurf].typeName.c_str(),
                                                degenSubSurfs[isubsurf].typeId,
                                                nospacename.c_str() );
 
-    fprintf( file_id, "# testType\n" );
-    fprintf( file_id, "%d\n", \
+    buf.Printf( "# testType\n" );
+    buf.Printf( "%d\n", \
             degenSubSurfs[isubsurf].testType );
 
     int n = degenSubSurfs[isubsurf].u.size();
 
-    fprintf( file_id, "# DegenGeom Type, nPts\n" );
-    fprintf( file_id, "SUBSURF_BNDY, %d\n", n );
-    fprintf( file_id, "# u,w,x,y,z\n" );
+    buf.Printf( "# DegenGeom Type, nPts\n" );
+    buf.Printf( "SUBSURF_BNDY, %d\n", n );
+    buf.Printf( "# u,w,x,y,z\n" );
     for ( int i = 0; i < n; i++ )
     {
-        fprintf( file_id, makeCsvFmt( 5 ).c_str(), \
+        buf.Printf( makeCsvFmt( 5 ).c_str(), \
                  degenSubSurfs[isubsurf].u[i],                  \
                  degenSubSurfs[isubsurf].w[i],                  \
                  degenSubSurfs[isubsurf].x[i].x(),              \
@@ -1152,17 +1159,17 @@ void DegenGeom::write_degenSubSurfCsv_file( FILE* file_id, int isubsurf )
     }
 }
 
-void DegenGeom::write_degenHingeLineCsv_file( FILE* file_id, int ihingeline )
+void DegenGeom::write_degenHingeLineCsv_file( TextBuffer &buf, int ihingeline )
 {
     int n = degenHingeLines[ihingeline].uStart.size();
 
-    fprintf( file_id, "# DegenGeom Type, name, nPts\n" );
-    fprintf( file_id, "HINGELINE,%s, %d\n", degenHingeLines[ihingeline].name.c_str(), n );
+    buf.Printf( "# DegenGeom Type, name, nPts\n" );
+    buf.Printf( "HINGELINE,%s, %d\n", degenHingeLines[ihingeline].name.c_str(), n );
 
-    fprintf( file_id, "# uStart,uEnd,wStart,wEnd,xStart,yStart,zStart,xEnd,yEnd,zEnd\n" );
+    buf.Printf( "# uStart,uEnd,wStart,wEnd,xStart,yStart,zStart,xEnd,yEnd,zEnd\n" );
     for ( int i = 0; i < n; i++ )
     {
-        fprintf( file_id, makeCsvFmt( 10 ).c_str(), \
+        buf.Printf( makeCsvFmt( 10 ).c_str(), \
                 degenHingeLines[ihingeline].uStart[i], \
                 degenHingeLines[ihingeline].uEnd[i], \
                 degenHingeLines[ihingeline].wStart[i], \
@@ -1176,7 +1183,7 @@ void DegenGeom::write_degenHingeLineCsv_file( FILE* file_id, int ihingeline )
     }
 }
 
-void DegenGeom::write_degenGeomCsv_file( FILE* file_id )
+void DegenGeom::write_degenGeomCsv_file( TextBuffer &buf )
 {
     int nxsecs = num_xsecs;
 
@@ -1199,33 +1206,33 @@ void DegenGeom::write_degenGeomCsv_file( FILE* file_id )
         typestr = "BODY";
     }
 
-    fprintf( file_id, "\n# DegenGeom Type, Name, SurfNdx, GeomID, MainSurfNdx, SymCopyNdx, FlipNormal," );
-    fprintf( file_id, "t00,t01,t02,t03,t10,t11,t12,t13,t20,t21,t22,t23,t30,t31,t32,t33" );
-    fprintf( file_id, "\n%s,%s,%d,%s,%d,%d,%d,", typestr.c_str(), name.c_str(), getSurfNum(),
+    buf.Printf( "\n# DegenGeom Type, Name, SurfNdx, GeomID, MainSurfNdx, SymCopyNdx, FlipNormal," );
+    buf.Printf( "t00,t01,t02,t03,t10,t11,t12,t13,t20,t21,t22,t23,t30,t31,t32,t33" );
+    buf.Printf( "\n%s,%s,%d,%s,%d,%d,%d,", typestr.c_str(), name.c_str(), getSurfNum(),
             this->parentGeom->GetID().c_str(), getMainSurfInd(), getSymCopyInd(), getFlipNormal() );
 
     for( int j = 0; j < 16; j ++ )
     {
-        fprintf( file_id, makeCsvFmt( 1, false ).c_str(), transmat[j] );
+        buf.Printf( makeCsvFmt( 1, false ).c_str(), transmat[j] );
 
         if( j < 16 - 1 )
         {
-            fprintf( file_id, ", " );
+            buf.Printf( ", " );
         }
         else
         {
-            fprintf( file_id, "\n" );
+            buf.Printf( "\n" );
         }
     }
 
     if( type == DISK_TYPE )
     {
-        write_degenGeomDiskCsv_file( file_id );
+        write_degenGeomDiskCsv_file( buf );
     }
 
     if( type != MESH_TYPE )
     {
-        write_degenGeomSurfCsv_file( file_id, nxsecs );
+        write_degenGeomSurfCsv_file( buf, nxsecs );
     }
 
     if( type == DISK_TYPE )
@@ -1235,38 +1242,38 @@ void DegenGeom::write_degenGeomCsv_file( FILE* file_id )
 
     if( degenPlates.size() > 0 )
     {
-        write_degenGeomPlateCsv_file( file_id, nxsecs, degenPlates[0] );
+        write_degenGeomPlateCsv_file( buf, nxsecs, degenPlates[0] );
     }
 
     if ( type == DegenGeom::BODY_TYPE && degenPlates.size() > 1 )
     {
-        write_degenGeomPlateCsv_file( file_id, nxsecs, degenPlates[1] );
+        write_degenGeomPlateCsv_file( buf, nxsecs, degenPlates[1] );
     }
 
     if ( degenSticks.size() > 0 )
     {
-        write_degenGeomStickCsv_file( file_id, nxsecs, degenSticks[0] );
+        write_degenGeomStickCsv_file( buf, nxsecs, degenSticks[0] );
     }
 
     if ( type == DegenGeom::BODY_TYPE && degenSticks.size() > 1 )
     {
-        write_degenGeomStickCsv_file( file_id, nxsecs, degenSticks[1] );
+        write_degenGeomStickCsv_file( buf, nxsecs, degenSticks[1] );
     }
 
-    write_degenGeomPointCsv_file( file_id );
+    write_degenGeomPointCsv_file( buf );
 
     for ( int i = 0; i < degenSubSurfs.size(); i++ )
     {
-        write_degenSubSurfCsv_file( file_id, i );
+        write_degenSubSurfCsv_file( buf, i );
     }
 
     for ( int i = 0; i < degenHingeLines.size(); i++ )
     {
-        write_degenHingeLineCsv_file( file_id, i );
+        write_degenHingeLineCsv_file( buf, i );
     }
 }
 
-void DegenGeom::write_degenGeomSurfM_file( FILE* file_id, int nxsecs )
+void DegenGeom::write_degenGeomSurfM_file( TextBuffer &buf, int nxsecs )
 {
     string basename = string( "degenGeom(end).surf." );
 
@@ -1274,17 +1281,17 @@ void DegenGeom::write_degenGeomSurfM_file( FILE* file_id, int nxsecs )
     WriteMatVec3dM writeMatVec3d;
     WriteMatDoubleM writeMatDouble;
 
-    fprintf( file_id, "degenGeom(end).surf.nxsecs = %d;\n", nxsecs );
-    fprintf( file_id, "degenGeom(end).surf.num_pnts = %d;\n", num_pnts );
+    buf.Printf( "degenGeom(end).surf.nxsecs = %d;\n", nxsecs );
+    buf.Printf( "degenGeom(end).surf.num_pnts = %d;\n", num_pnts );
 
-    writeMatVec3d.write(  file_id, degenSurface.x,    basename, nxsecs, num_pnts );
-    writeMatDouble.write( file_id, degenSurface.u,    basename + "u",   nxsecs,      num_pnts );
-    writeMatDouble.write( file_id, degenSurface.w,    basename + "w",   nxsecs,      num_pnts );
-    writeMatVec3d.write(  file_id, degenSurface.nvec, basename + "n",   nxsecs - 1,    num_pnts - 1 );
-    writeMatDouble.write( file_id, degenSurface.area, basename + "area", nxsecs - 1,    num_pnts - 1 );
+    writeMatVec3d.write( buf, degenSurface.x,    basename, nxsecs, num_pnts );
+    writeMatDouble.write( buf, degenSurface.u,    basename + "u",   nxsecs,      num_pnts );
+    writeMatDouble.write( buf, degenSurface.w,    basename + "w",   nxsecs,      num_pnts );
+    writeMatVec3d.write( buf, degenSurface.nvec, basename + "n",   nxsecs - 1,    num_pnts - 1 );
+    writeMatDouble.write( buf, degenSurface.area, basename + "area", nxsecs - 1,    num_pnts - 1 );
 }
 
-void DegenGeom::write_degenGeomPlateM_file( FILE* file_id, int nxsecs, DegenPlate &degenPlate, int iplate )
+void DegenGeom::write_degenGeomPlateM_file( TextBuffer &buf, int nxsecs, DegenPlate &degenPlate, int iplate )
 {
     char num[80];
     snprintf( num, sizeof( num ), "degenGeom(end).plate(%d).", iplate );
@@ -1295,21 +1302,21 @@ void DegenGeom::write_degenGeomPlateM_file( FILE* file_id, int nxsecs, DegenPlat
     WriteMatDoubleM writeMatDouble;
     WriteMatVec3dM writeMatVec3d;
 
-    fprintf( file_id, "degenGeom(end).plate(%d).nxsecs = %d;\n", iplate, nxsecs );
-    fprintf( file_id, "degenGeom(end).plate(%d).num_pnts = %d;\n", iplate, ( num_pnts + 1 ) / 2 );
-
-    writeVecVec3d.write(  file_id, degenPlate.nPlate,  basename + "n",       nxsecs );
-    writeMatVec3d.write(  file_id, degenPlate.x,       basename,             nxsecs,    ( num_pnts + 1 ) / 2 );
-    writeMatVec3d.write(  file_id, degenPlate.xCamber,       basename + "xCamber", nxsecs,    ( num_pnts + 1 ) / 2 );
-    writeMatDouble.write( file_id, degenPlate.zcamber, basename + "zCamber", nxsecs,    ( num_pnts + 1 ) / 2 );
-    writeMatDouble.write( file_id, degenPlate.t,       basename + "t",       nxsecs,    ( num_pnts + 1 ) / 2 );
-    writeMatVec3d.write(  file_id, degenPlate.nCamber, basename + "nCamber", nxsecs,    ( num_pnts + 1 ) / 2 );
-    writeMatDouble.write( file_id, degenPlate.u,       basename + "u",       nxsecs,    ( num_pnts + 1 ) / 2 );
-    writeMatDouble.write( file_id, degenPlate.wTop,    basename + "wTop",    nxsecs,    ( num_pnts + 1 ) / 2 );
-    writeMatDouble.write( file_id, degenPlate.wBot,    basename + "wBot",    nxsecs,    ( num_pnts + 1 ) / 2 );
+    buf.Printf( "degenGeom(end).plate(%d).nxsecs = %d;\n", iplate, nxsecs );
+    buf.Printf( "degenGeom(end).plate(%d).num_pnts = %d;\n", iplate, ( num_pnts + 1 ) / 2 );
+
+    writeVecVec3d.write( buf, degenPlate.nPlate,  basename + "n",       nxsecs );
+    writeMatVec3d.write( buf, degenPlate.x,       basename,             nxsecs,    ( num_pnts + 1 ) / 2 );
+    writeMatVec3d.write( buf, degenPlate.xCamber,       basename + "xCamber", nxsecs,    ( num_pnts + 1 ) / 2 );
+    writeMatDouble.write( buf, degenPlate.zcamber, basename + "zCamber", nxsecs,    ( num_pnts + 1 ) / 2 );
+    writeMatDouble.write( buf, degenPlate.t,       basename + "t",       nxsecs,    ( num_pnts + 1 ) / 2 );
+    writeMatVec3d.write( buf, degenPlate.nCamber, basename + "nCamber", nxsecs,    ( num_pnts + 1 ) / 2 );
+    writeMatDouble.write( buf, degenPlate.u,       basename + "u",       nxsecs,    ( num_pnts + 1 ) / 2 );
+    writeMatDouble.write( buf, degenPlate.wTop,    basename + "wTop",    nxsecs,    ( num_pnts + 1 ) / 2 );
+    writeMatDouble.write( buf, degenPlate.wBot,    basename + "wBot",    nxsecs,    ( num_pnts + 1 ) / 2 );
 }
 
-void DegenGeom::write_degenGeomStickM_file( FILE* file_id, int nxsecs, DegenStick &degenStick, int istick )
+void DegenGeom::write_degenGeomStickM_file( TextBuffer &buf, int nxsecs, DegenStick &degenStick, int istick )
 {
     char num[80];
     snprintf( num, sizeof( num ), "degenGeom(end).stick(%d).", istick );
@@ -1319,39 +1326,39 @@ void DegenGeom::write_degenGeomStickM_file( FILE* file_id, int nxsecs, DegenStic
     WriteVecVec3dM writeVecVec3d;
     WriteMatDoubleM writeMatDouble;
 
-    fprintf( file_id, "degenGeom(end).stick(%d).nxsecs = %d;\n", istick, nxsecs );
-
-    writeVecVec3d.write(  file_id, degenStick.xle,        basename + "le",         nxsecs );
-    writeVecVec3d.write(  file_id, degenStick.xte,        basename + "te",         nxsecs );
-    writeVecVec3d.write(  file_id, degenStick.xcgShell,   basename + "cgShell",    nxsecs );
-    writeVecVec3d.write(  file_id, degenStick.xcgSolid,   basename + "cgSolid",    nxsecs );
-    writeVecDouble.write( file_id, degenStick.toc,        basename + "toc",        nxsecs );
-    writeVecDouble.write( file_id, degenStick.tLoc,       basename + "tLoc",       nxsecs );
-    writeVecDouble.write( file_id, degenStick.chord,      basename + "chord",      nxsecs );
-    writeMatDouble.write( file_id, degenStick.Ishell,     basename + "Ishell",     nxsecs,        3 );
-    writeMatDouble.write( file_id, degenStick.Isolid,     basename + "Isolid",     nxsecs,        3 );
-    writeVecDouble.write( file_id, degenStick.sectarea,   basename + "sectArea",   nxsecs );
-    writeVecVec3d.write(  file_id, degenStick.sectnvec,   basename + "sectNormal", nxsecs );
-    writeVecDouble.write( file_id, degenStick.perimTop,   basename + "perimTop",   nxsecs );
-    writeVecDouble.write( file_id, degenStick.perimBot,   basename + "perimBot",   nxsecs );
-    writeVecDouble.write( file_id, degenStick.u,          basename + "u",          nxsecs );
-    writeMatDouble.write( file_id, degenStick.transmat,   basename + "transmat",   nxsecs,        16 );
-    writeMatDouble.write( file_id, degenStick.invtransmat, basename + "invtransmat", nxsecs,        16 );
-    writeVecDouble.write( file_id, degenStick.toc2,       basename + "toc2",       nxsecs );
-    writeVecDouble.write( file_id, degenStick.tLoc2,      basename + "tLoc2",      nxsecs );
-    writeVecDouble.write( file_id, degenStick.anglele,    basename + "anglele",    nxsecs );
-    writeVecDouble.write( file_id, degenStick.anglete,    basename + "anglete",    nxsecs );
-    writeVecDouble.write( file_id, degenStick.radleTop,   basename + "radleTop",   nxsecs );
-    writeVecDouble.write( file_id, degenStick.radleBot,   basename + "radleBot",   nxsecs );
-
-    writeVecDouble.write( file_id, degenStick.sweeple,    basename + "sweeple",    nxsecs - 1 );
-    writeVecDouble.write( file_id, degenStick.sweepte,    basename + "sweepte",    nxsecs - 1 );
-    writeVecDouble.write( file_id, degenStick.areaTop,    basename + "areaTop",    nxsecs - 1 );
-    writeVecDouble.write( file_id, degenStick.areaBot,    basename + "areaBot",    nxsecs - 1 );
+    buf.Printf( "degenGeom(end).stick(%d).nxsecs = %d;\n", istick, nxsecs );
+
+    writeVecVec3d.write( buf, degenStick.xle,        basename + "le",         nxsecs );
+    writeVecVec3d.write( buf, degenStick.xte,        basename + "te",         nxsecs );
+    writeVecVec3d.write( buf, degenStick.xcgShell,   basename + "cgShell",    nxsecs );
+    writeVecVec3d.write( buf, degenStick.xcgSolid,   basename + "cgSolid",    nxsecs );
+    writeVecDouble.write( buf, degenStick.toc,        basename + "toc",        nxsecs );
+    writeVecDouble.write( buf, degenStick.tLoc,       basename + "tLoc",       nxsecs );
+    writeVecDouble.write( buf, degenStick.chord,      basename + "chord",      nxsecs );
+    writeMatDouble.write( buf, degenStick.Ishell,     basename + "Ishell",     nxsecs,        3 );
+    writeMatDouble.write( buf, degenStick.Isolid,     basename + "Isolid",     nxsecs,        3 );
+    writeVecDouble.write( buf, degenStick.sectarea,   basename + "sectArea",   nxsecs );
+    writeVecVec3d.write( buf, degenStick.sectnvec,   basename + "sectNormal", nxsecs );
+    writeVecDouble.write( buf, degenStick.perimTop,   basename + "perimTop",   nxsecs );
+    writeVecDouble.write( buf, degenStick.perimBot,   basename + "perimBot",   nxsecs );
+    writeVecDouble.write( buf, degenStick.u,          basename + "u",          nxsecs );
+    writeMatDouble.write( buf, degenStick.transmat,   basename + "transmat",   nxsecs,        16 );
+    writeMatDouble.write( buf, degenStick.invtransmat, basename + "invtransmat", nxsecs,        16 );
+    writeVecDouble.write( buf, degenStick.toc2,       basename + "toc2",       nxsecs );
+    writeVecDouble.write( buf, degenStick.tLoc2,      basename + "tLoc2",      nxsecs );
+    writeVecDouble.write( buf, degenStick.anglele,    basename + "anglele",    nxsecs );
+    writeVecDouble.write( buf, degenStick.anglete,    basename + "anglete",    nxsecs );
+    writeVecDouble.write( buf, degenStick.radleTop,   basename + "radleTop",   nxsecs );
+    writeVecDouble.write( buf, degenStick.radleBot,   basename + "radleBot",   nxsecs );
+
+    writeVecDouble.write( buf, degenStick.sweeple,    basename + "sweeple",    nxsecs - 1 );
+    writeVecDouble.write( buf, degenStick.sweepte,    basename + "sweepte",    nxsecs - 1 );
+    writeVecDouble.write( buf, degenStick.areaTop,    basename + "areaTop",    nxsecs - 1 );
+    writeVecDouble.write( buf, degenStick.areaBot,    basename + "areaBot",    nxsecs - 1 );
 
 }
 
-void DegenGeom::write_degenGeomPointM_file( FILE* file_id )
+void DegenGeom::write_degenGeomPointM_file( TextBuffer &buf )
 {
     string basename = string( "degenGeom(end).point." );
 
@@ -1359,29 +1366,29 @@ void DegenGeom::write_degenGeomPointM_file( FILE* file_id )
     WriteVec3dM writeVec3d;
     WriteVecDoubleM writeVecDouble;
 
-    writeDouble.write(    file_id, degenPoint.vol[0],      basename + "vol" );
-    writeDouble.write(    file_id, degenPoint.volWet[0],   basename + "volWet" );
-    writeDouble.write(    file_id, degenPoint.area[0],     basename + "area" );
-    writeDouble.write(    file_id, degenPoint.areaWet[0],  basename + "areaWet" );
-    writeVecDouble.write( file_id, degenPoint.Ishell[0],   basename + "Ishell",     6 );
-    writeVecDouble.write( file_id, degenPoint.Isolid[0],   basename + "Isolid",     6 );
-    writeVec3d.write(     file_id, degenPoint.xcgShell[0], basename + "cgShell" );
-    writeVec3d.write(     file_id, degenPoint.xcgSolid[0], basename + "cgSolid" );
+    writeDouble.write( buf, degenPoint.vol[0],      basename + "vol" );
+    writeDouble.write( buf, degenPoint.volWet[0],   basename + "volWet" );
+    writeDouble.write( buf, degenPoint.area[0],     basename + "area" );
+    writeDouble.write( buf, degenPoint.areaWet[0],  basename + "areaWet" );
+    writeVecDouble.write( buf, degenPoint.Ishell[0],   basename + "Ishell",     6 );
+    writeVecDouble.write( buf, degenPoint.Isolid[0],   basename + "Isolid",     6 );
+    writeVec3d.write( buf, degenPoint.xcgShell[0], basename + "cgShell" );
+    writeVec3d.write( buf, degenPoint.xcgSolid[0], basename + "cgSolid" );
 }
 
-void DegenGeom::write_degenGeomDiskM_file( FILE* file_id )
+void DegenGeom::write_degenGeomDiskM_file( TextBuffer &buf )
 {
     string basename = string( "degenGeom(end).disk." );
 
     WriteDoubleM writeDouble;
     WriteVec3dM writeVec3d;
 
-    writeDouble.write( file_id, degenDisk.d,    basename + "diameter" );
-    writeVec3d.write(  file_id, degenDisk.x,    basename );
-    writeVec3d.write(  file_id, degenDisk.nvec, basename + "n" );
+    writeDouble.write( buf, degenDisk.d,    basename + "diameter" );
+    writeVec3d.write( buf, degenDisk.x,    basename );
+    writeVec3d.write( buf, degenDisk.nvec, basename + "n" );
 }
 
-void DegenGeom::write_degenSubSurfM_file( FILE* file_id, int isubsurf )
+void DegenGeom::write_degenSubSurfM_file( TextBuffer &buf, int isubsurf )
 {
     char num[80];
     snprintf( num, sizeof( num ), "degenGeom(end).subsurf(%d).", isubsurf + 1 );
@@ -1390,20 +1397,20 @@ void DegenGeom::write_degenSubSurfM_file( FILE* file_id, int isubsurf )
     WriteVecDoubleM writeVecDouble;
     WriteVecVec3dM writeVecVec3d;
 
-    fprintf( file_id, "\ndegenGeom(end).subsurf(%d).name = '%s';\n", isubsurf + 1, degenSubSurfs[isubsurf].name.c_str() );
-    fprintf( file_id, "\ndegenGeom(end).subsurf(%d).typeName = %d;\n", isubsurf + 1, degenSubSurfs[isubsurf].testType );
-    fprintf( file_id, "\ndegenGeom(end).subsurf(%d).typeId = %d;\n", isubsurf + 1, degenSubSurfs[isubsurf].testType );
-    fprintf( file_id, "\ndegenGeom(end).subsurf(%d).fullName = '%s';\n", isubsurf + 1, degenSubSurfs[isubsurf].fullName.c_str() );
-    fprintf( file_id, "\ndegenGeom(end).subsurf(%d).testType = %d;\n", isubsurf + 1, degenSubSurfs[isubsurf].testType );
+    buf.Printf( "\ndegenGeom(end).subsurf(%d).name = '%s';\n", isubsurf + 1, degenSubSurfs[isubsurf].name.c_str() );
+    buf.Printf( "\ndegenGeom(end).subsurf(%d).typeName = %d;\n", isubsurf + 1, degenSubSurfs[isubsurf].testType );
+    buf.Printf( "\ndegenGeom(end).subsurf(%d).typeId = %d;\n", isubsurf + 1, degenSubSurfs[isubsurf].testType );
+    buf.Printf( "\ndegenGeom(end).subsurf(%d).fullName = '%s';\n", isubsurf + 1, degenSubSurfs[isubsurf].fullName.c_str() );
+    buf.Printf( "\ndegenGeom(end).subsurf(%d).testType = %d;\n", isubsurf + 1, degenSubSurfs[isubsurf].testType );
 
     int n = degenSubSurfs[isubsurf].u.size();
 
-    writeVecDouble.write( file_id, degenSubSurfs[isubsurf].u,        basename + "u",        n );
-    writeVecDouble.write( file_id, degenSubSurfs[isubsurf].w,        basename + "w",        n );
-    writeVecVec3d.write( file_id, degenSubSurfs[isubsurf].x,         basename + "x",        n );
+    writeVecDouble.write( buf, degenSubSurfs[isubsurf].u,        basename + "u",        n );
+    writeVecDouble.write( buf, degenSubSurfs[isubsurf].w,        basename + "w",        n );
+    writeVecVec3d.write( buf, degenSubSurfs[isubsurf].x,         basename + "x",        n );
 }
 
-void DegenGeom::write_degenHingeLineM_file( FILE* file_id, int ihingeline )
+void DegenGeom::write_degenHingeLineM_file( TextBuffer &buf, int ihingeline )
 {
     char num[80];
     snprintf( num, sizeof( num ), "degenGeom(end).hingeline(%d).", ihingeline + 1 );
@@ -1412,19 +1419,19 @@ void DegenGeom::write_degenHingeLineM_file( FILE* file_id, int ihingeline )
     WriteVecDoubleM writeVecDouble;
     WriteVecVec3dM writeVecVec3d;
 
-    fprintf( file_id, "\ndegenGeom(end).hingeline(%d).name = '%s';\n", ihingeline + 1, degenHingeLines[ihingeline].name.c_str() );
+    buf.Printf( "\ndegenGeom(end).hingeline(%d).name = '%s';\n", ihingeline + 1, degenHingeLines[ihingeline].name.c_str() );
 
     int n = degenHingeLines[ihingeline].uStart.size();
 
-    writeVecDouble.write( file_id, degenHingeLines[ihingeline].uStart,        basename + "uStart",        n );
-    writeVecDouble.write( file_id, degenHingeLines[ihingeline].uEnd,          basename + "uEnd",          n );
-    writeVecDouble.write( file_id, degenHingeLines[ihingeline].wStart,        basename + "wStart",        n );
-    writeVecDouble.write( file_id, degenHingeLines[ihingeline].wEnd,          basename + "wEnd",          n );
-    writeVecVec3d.write( file_id, degenHingeLines[ihingeline].xStart,         basename + "xStart",        n );
-    writeVecVec3d.write( file_id, degenHingeLines[ihingeline].xEnd,           basename + "xEnd",        n );
+    writeVecDouble.write( buf, degenHingeLines[ihingeline].uStart,        basename + "uStart",        n );
+    writeVecDouble.write( buf, degenHingeLines[ihingeline].uEnd,          basename + "uEnd",          n );
+    writeVecDouble.write( buf, degenHingeLines[ihingeline].wStart,        basename + "wStart",        n );
+    writeVecDouble.write( buf, degenHingeLines[ihingeline].wEnd,          basename + "wEnd",          n );
+    writeVecVec3d.write( buf, degenHingeLines[ihingeline].xStart,         basename + "xStart",        n );
+    writeVecVec3d.write( buf, degenHingeLines[ihingeline].xEnd,           basename + "xEnd",        n );
 }
 
-void DegenGeom::write_degenGeomM_file( FILE* file_id )
+void DegenGeom::write_degenGeomM_file( TextBuffer &buf )
 {
     int nxsecs = num_xsecs;
 
@@ -1432,38 +1439,38 @@ void DegenGeom::write_degenGeomM_file( FILE* file_id )
 
     if( type == SURFACE_TYPE )
     {
-        fprintf( file_id, "\ndegenGeom(end+1).type = 'LIFTING_SURFACE';" );
+        buf.Printf( "\ndegenGeom(end+1).type = 'LIFTING_SURFACE';" );
     }
     else if( type == DISK_TYPE )
     {
-        fprintf( file_id, "\ndegenGeom(end+1).type = 'DISK';" );
+        buf.Printf( "\ndegenGeom(end+1).type = 'DISK';" );
     }
     else if( type == MESH_TYPE )
     {
-        fprintf( file_id, "\ndegenGeom(end+1).type = 'MESH';" );
+        buf.Printf( "\ndegenGeom(end+1).type = 'MESH';" );
     }
     else
     {
-        fprintf( file_id, "\ndegenGeom(end+1).type = 'BODY';" );
+        buf.Printf( "\ndegenGeom(end+1).type = 'BODY';" );
     }
 
-    fprintf( file_id, "\ndegenGeom(end).name = '%s';", name.c_str() );
-    fprintf( file_id, "\ndegenGeom(end).geom_id = '%s';", parentGeom->GetID().c_str() );
-    fprintf( file_id, "\ndegenGeom(end).surf_index = %d;", getSurfNum() );
-    fprintf( file_id, "\ndegenGeom(end).main_surf_index = %d;", getMainSurfInd() );
-    fprintf( file_id, "\ndegenGeom(end).sym_copy_index = %d;", getSymCopyInd() );
-    fprintf( file_id, "\ndegenGeom(end).flip_normal = %d;\n", getFlipNormal() );
+    buf.Printf( "\ndegenGeom(end).name = '%s';", name.c_str() );
+    buf.Printf( "\ndegenGeom(end).geom_id = '%s';", parentGeom->GetID().c_str() );
+    buf.Printf( "\ndegenGeom(end).surf_index = %d;", getSurfNum() );
+    buf.Printf( "\ndegenGeom(end).main_surf_index = %d;", getMainSurfInd() );
+    buf.Printf( "\ndegenGeom(end).sym_copy_index = %d;", getSymCopyInd() );
+    buf.Printf( "\ndegenGeom(end).flip_normal = %d;\n", getFlipNormal() );
 
-    writeVecDouble.write( file_id, transmat, "degenGeom(end).transmat",    16 );
+    writeVecDouble.write( buf, transmat, "degenGeom(end).transmat",    16 );
 
     if( type == DISK_TYPE )
     {
-        write_degenGeomDiskM_file(file_id);
+        write_degenGeomDiskM_file( buf );
     }
 
     if ( type != MESH_TYPE )
     {
-        write_degenGeomSurfM_file( file_id, nxsecs );
+        write_degenGeomSurfM_file( buf, nxsecs );
     }
 
     if( type == DISK_TYPE )
@@ -1472,31 +1479,31 @@ void DegenGeom::write_degenGeomM_file( FILE* file_id )
     }
 
     if ( degenPlates.size() > 0 )
-        write_degenGeomPlateM_file( file_id, nxsecs, degenPlates[0], 1 );
+        write_degenGeomPlateM_file( buf, nxsecs, degenPlates[0], 1 );
 
     if ( type == DegenGeom::BODY_TYPE && degenPlates.size() > 1 )
     {
-        write_degenGeomPlateM_file( file_id, nxsecs, degenPlates[1], 2 );
+        write_degenGeomPlateM_file( buf, nxsecs, degenPlates[1], 2 );
     }
 
     if ( degenSticks.size() > 0 )
-        write_degenGeomStickM_file( file_id, nxsecs, degenSticks[0], 1 );
+        write_degenGeomStickM_file( buf, nxsecs, degenSticks[0], 1 );
 
     if ( type == DegenGeom::BODY_TYPE && degenSticks.size() > 1 )
     {
-        write_degenGeomStickM_file( file_id, nxsecs, degenSticks[1], 2 );
+        write_degenGeomStickM_file( buf, nxsecs, degenSticks[1], 2 );
     }
 
-    write_degenGeomPointM_file( file_id );
+    write_degenGeomPointM_file( buf );
 
     for ( int i = 0; i < degenSubSurfs.size(); i++ )
     {
-        write_degenSubSurfM_file( file_id, i );
+        write_degenSubSurfM_file( buf, i );
     }
 
     for ( int i = 0; i < degenHingeLines.size(); i++ )
     {
-        write_degenHingeLineM_file( file_id, i );
+        write_degenHingeLineM_file( buf, i );
     }
 }
 
@@ -15,6 +15,7 @@
 #include "Matrix4d.h"
 #include "SubSurface.h"
 #include "ResultsMgr.h"
+#include "TextBuffer.h"
 
 using namespace std;
 
@@ -301,24 +302,24 @@ public:
     void addDegenSubSurf( SubSurface *ssurf, int surfIndx );
     void addDegenHingeLine( SSControlSurf *csurf, int surfIndx );
 
-    static string makeCsvFmt( int n, bool newline = true );
-    void write_degenGeomCsv_file( FILE* file_id );
-    void write_degenGeomSurfCsv_file( FILE* file_id, int nxsecs );
-    void write_degenGeomPlateCsv_file( FILE* file_id, int nxsecs, DegenPlate &degenPlate );
-    void write_degenGeomStickCsv_file( FILE* file_id, int nxsecs, DegenStick &degenStick );
-    void write_degenGeomPointCsv_file( FILE* file_id );
-    void write_degenGeomDiskCsv_file( FILE* file_id );
-    void write_degenSubSurfCsv_file( FILE* file_id, int isubsurf );
-    void write_degenHingeLineCsv_file( FILE* file_id, int ihingeline );
-
-    void write_degenGeomM_file( FILE* file_id );
-    void write_degenGeomSurfM_file( FILE* file_id, int nxsecs );
-    void write_degenGeomPlateM_file( FILE* file_id, int nxsecs, DegenPlate &degenPlate, int iplate );
-    static void write_degenGeomStickM_file( FILE* file_id, int nxsecs, DegenStick &degenStick, int istick );
-    void write_degenGeomPointM_file( FILE* file_id );
-    void write_degenGeomDiskM_file( FILE* file_id );
-    void write_degenSubSurfM_file( FILE* file_id, int isubsurf );
-    void write_degenHingeLineM_file( FILE* file_id, int ihingeline );
+    static const string & makeCsvFmt( int n, bool newline = true );
+    void write_degenGeomCsv_file( TextBuffer &buf );
+    void write_degenGeomSurfCsv_file( TextBuffer &buf, int nxsecs );
+    void write_degenGeomPlateCsv_file( TextBuffer &buf, int nxsecs, DegenPlate &degenPlate );
+    void write_degenGeomStickCsv_file( TextBuffer &buf, int nxsecs, DegenStick &degenStick );
+    void write_degenGeomPointCsv_file( TextBuffer &buf );
+    void write_degenGeomDiskCsv_file( TextBuffer &buf );
+    void write_degenSubSurfCsv_file( TextBuffer &buf, int isubsurf );
+    void write_degenHingeLineCsv_file( TextBuffer &buf, int ihingeline );
+
+    void write_degenGeomM_file( TextBuffer &buf );
+    void write_degenGeomSurfM_file( TextBuffer &buf, int nxsecs );
+    void write_degenGeomPlateM_file( TextBuffer &buf, int nxsecs, DegenPlate &degenPlate, int iplate );
+    static void write_degenGeomStickM_file( TextBuffer &buf, int nxsecs, DegenStick &degenStick, int istick );
+    void write_degenGeomPointM_file( TextBuffer &buf );
+    void write_degenGeomDiskM_file( TextBuffer &buf );
+    void write_degenSubSurfM_file( TextBuffer &buf, int isubsurf );
+    void write_degenHingeLineM_file( TextBuffer &buf, int ihingeline );
 
     void write_degenGeomResultsManager( vector< string> &degen_results_ids );
     void write_degenGeomDiskResultsManager( Results * res );
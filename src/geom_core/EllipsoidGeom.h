@@ -35,6 +35,9 @@ public:
 protected:
     virtual void UpdateSurf();
 
+    virtual bool GetCacheableFlag()                         { return true; }
+    virtual void AppendCacheKey( vector< double > & key )   { key.push_back( m_Xoff ); }
+
     double m_Xoff;
 };
 
@@ -16,6 +16,7 @@
 #include "SubSurfaceMgr.h"
 #include "HingeGeom.h"
 #include "VspUtil.h"
+#include "GeomCacheMgr.h"
 using namespace vsp;
 
 #include <float.h>
@@ -173,6 +174,10 @@ void GeomBase::SetDirtyFlags( Parm* parm_ptr )
     {
         m_TessDirty = true;
     }
+    else if ( gname == string("AdaptTess") )
+    {
+        m_TessDirty = true;
+    }
     else if ( gname == string("EndCap") && pname == string("CapUMinTess") )
     {
         // This captures all geoms
@@ -431,11 +436,11 @@ xmlNodePtr GeomBase::DecodeXml( xmlNodePtr & node )
         m_ChildIDVec.clear();
 
         xmlNodePtr cl_node = XmlUtil::GetNode( child_node, "Child_List", 0 );
-        int num_children = XmlUtil::GetNumNames( cl_node, "Child" );
+        vector< xmlNodePtr > child_nodes = XmlUtil::GetNodeVec( cl_node, "Child" );
 
-        for ( int i = 0 ; i < num_children ; i++ )
+        for ( int i = 0 ; i < ( int )child_nodes.size() ; i++ )
         {
-            xmlNodePtr n = XmlUtil::GetNode( cl_node, "Child", i );
+            xmlNodePtr n = child_nodes[i];
             m_ChildIDVec.push_back( ParmMgr.RemapID( XmlUtil::FindString( n, "ID", string() ) ) );
         }
     }
@@ -905,7 +910,13 @@ void GeomXForm::ComposeModelMatrix()
 
 void GeomXForm::ComposeAttachMatrix()
 {
-    m_AttachMatrix.loadIdentity();
+    m_AttachMatrix = CompAttachMatrix();
+}
+
+//==== Attachment Matrix For The Current Parent And Attach Parms ====//
+Matrix4d GeomXForm::CompAttachMatrix()
+{
+    Matrix4d attachMat;
 
     Geom* parent = m_Vehicle->FindGeom( GetParentID() );
 
@@ -914,15 +925,14 @@ void GeomXForm::ComposeAttachMatrix()
         HingeGeom* hingeparent = dynamic_cast < HingeGeom* > ( parent );
         if ( hingeparent )
         {
-            m_AttachMatrix = hingeparent->GetJointMatrix();
-            return;
+            return hingeparent->GetJointMatrix();
         }
     }
 
     // If both attachment flags set to none, return identity
     if ( m_TransAttachFlag() == vsp::ATTACH_TRANS_NONE && m_RotAttachFlag() == vsp::ATTACH_ROT_NONE )
     {
-        return;
+        return attachMat;
     }
 
     if ( parent )
@@ -1042,9 +1052,10 @@ void GeomXForm::ComposeAttachMatrix()
         }
 
         transMat.matMult( rotMat.data() );
-        m_AttachMatrix = transMat;
+        attachMat = transMat;
     }
 
+    return attachMat;
 }
 
 //==== Set Rel or Abs Flag ====//
@@ -1291,6 +1302,16 @@ Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
     m_TessW.SetDescript( "Number of tessellated curves in the W direction" );
     m_TessW.SetMultShift( 4, 1 );
 
+    m_TessAdaptMode.Init( "TessAdaptMode", "AdaptTess", this, TESS_ADAPT_NONE, TESS_ADAPT_NONE, TESS_ADAPT_ALL );
+    m_TessAdaptMode.SetDescript( "Tessellations refined to meet the chord and angle tolerances" );
+    m_TessChordTol.Init( "ChordTol", "AdaptTess", this, 1.0e-3, 0.0, 1.0 );
+    m_TessChordTol.SetDescript( "Maximum chordal deviation as a fraction of the surface bounding box diagonal, zero to ignore" );
+    m_TessAngleTol.Init( "AngleTol", "AdaptTess", this, 10.0, 0.0, 90.0 );
+    m_TessAngleTol.SetDescript( "Maximum angle in degrees between adjacent tessellation normals, zero to ignore" );
+    m_TessAdaptLevel.Init( "MaxLevel", "AdaptTess", this, 3, 0, 8 );
+    m_TessAdaptLevel.SetDescript( "Maximum number of times each tessellation interval may be halved" );
+    m_AnalysisTessValid = false;
+
     //==== Wake Parms ====//
     m_WakeActiveFlag.Init( "Wake", "Shape", this, false, 0, 1 );
     m_WakeActiveFlag.SetDescript( "Flag that indicates if this WingGeom has wakes attached" );
@@ -1561,16 +1582,40 @@ void Geom::Update( bool fullupdate )
 
     UpdateSets();
 
-    if ( m_SurfDirty )
+    //==== Reuse Surfaces And Tessellation From An Identical Earlier Update ====//
+    bool cache_flag = fullupdate && ( m_SurfDirty || m_TessDirty ) && GetCacheableFlag() && GeomCacheMgr.GetMaxSize() > 0;
+    bool cache_hit = false;
+    GeomCacheEntry cache_entry;
+    vector< Parm* > derived_vec;
+    if ( cache_flag )
+    {
+        BuildCacheKey( cache_entry.m_Key, derived_vec );
+        cache_hit = GeomCacheMgr.Find( cache_entry ) && cache_entry.m_DerivedVals.size() == derived_vec.size();
+        if ( cache_hit )
+        {
+            m_MainSurfVec.swap( cache_entry.m_MainSurfVec );
+            m_CapUMinSuccess.swap( cache_entry.m_CapUMinSuccess );
+            m_CapUMaxSuccess.swap( cache_entry.m_CapUMaxSuccess );
+            m_CappingDone = true;
+            UpdateEndCapParms();
+
+            for ( int i = 0 ; i < ( int )derived_vec.size() ; i++ )
+            {
+                derived_vec[i]->Set( cache_entry.m_DerivedVals[i] );
+            }
+        }
+    }
+
+    if ( m_SurfDirty && !cache_hit )
         UpdateSurf();       // Must be implemented by subclass.
 
     if ( m_XFormDirty )
         UpdateXForm();
 
-    if ( m_SurfDirty )
+    if ( m_SurfDirty && !cache_hit )
         UpdateEndCaps();
 
-    if ( m_SurfDirty )
+    if ( m_SurfDirty && !cache_hit )
     {
         for ( int i = 0; i < m_MainSurfVec.size(); i++ )
         {
@@ -1579,12 +1624,12 @@ void Geom::Update( bool fullupdate )
         }
     }
 
-    if ( m_SurfDirty )
+    if ( m_SurfDirty && !cache_hit )
         UpdateEngine();
 
     if ( fullupdate )
     {
-        if ( m_SurfDirty )
+        if ( m_SurfDirty && !cache_hit )
             UpdateFeatureLines();
     }
 
@@ -1611,6 +1656,14 @@ void Geom::Update( bool fullupdate )
         UpdateSurfVec();
     }
 
+    if ( m_XFormDirty || m_SurfDirty || m_TessDirty )
+    {
+        UpdateTessAdapt();
+
+        std::lock_guard< std::mutex > lock( m_AnalysisTessMutex );
+        m_AnalysisTessValid = false;
+    }
+
     if ( fullupdate ) // Option to make FitModel and similar things faster.
     {
         for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
@@ -1632,10 +1685,40 @@ void Geom::Update( bool fullupdate )
         // Tessellate MainSurfVec
         if ( m_SurfDirty || m_TessDirty )
         {
-            UpdateMainTessVec();
+            if ( cache_hit )
+            {
+                m_MainTessVec.swap( cache_entry.m_MainTessVec );
+                m_MainFeatureTessVec.swap( cache_entry.m_MainFeatureTessVec );
+            }
+            else
+            {
+                UpdateMainTessVec();
+            }
             UpdateMainDegenGeomPreview();
         }
 
+        // Only keep updates that left their own inputs alone, a later hit skips those writes
+        vector< double > post_key;
+        if ( cache_flag && !cache_hit )
+        {
+            BuildCacheKey( post_key, derived_vec );
+        }
+
+        if ( cache_flag && !cache_hit && post_key == cache_entry.m_Key )
+        {
+            cache_entry.m_DerivedVals.resize( derived_vec.size() );
+            for ( int i = 0 ; i < ( int )derived_vec.size() ; i++ )
+            {
+                cache_entry.m_DerivedVals[i] = derived_vec[i]->Get();
+            }
+            cache_entry.m_MainSurfVec = m_MainSurfVec;
+            cache_entry.m_CapUMinSuccess = m_CapUMinSuccess;
+            cache_entry.m_CapUMaxSuccess = m_CapUMaxSuccess;
+            cache_entry.m_MainTessVec = m_MainTessVec;
+            cache_entry.m_MainFeatureTessVec = m_MainFeatureTessVec;
+            GeomCacheMgr.Add( cache_entry );
+        }
+
         // Copy Tessellation for symmetry and XForm
         if ( m_XFormDirty || m_SurfDirty || m_TessDirty )
         {
@@ -1647,6 +1730,7 @@ void Geom::Update( bool fullupdate )
     if ( m_XFormDirty || m_SurfDirty )
     {
         UpdateBBox();  // Needs to happen for both XForm and Surf updates.
+        m_Vehicle->SetGeomBBoxDirty( GetID() );
     }
 
     if ( fullupdate )
@@ -1781,6 +1865,12 @@ void Geom::UpdateEndCaps()
         m_CapUMaxSuccess[i] = m_MainSurfVec[i].CapUMax(m_CapUMaxOption(), m_CapUMaxLength(), m_CapUMaxStrength(), m_CapUMaxOffset(), ptoff, m_CapUMaxSweepFlag());
     }
 
+    UpdateEndCapParms();
+}
+
+//==== Reset Cap Parms The Chosen Cap Types Do Not Use ====//
+void Geom::UpdateEndCapParms()
+{
     switch( m_CapUMinOption() ){
         case NO_END_CAP:
         case FLAT_END_CAP:
@@ -1840,6 +1930,110 @@ void Geom::UpdateEndCaps()
     }
 }
 
+//==== Parms That Can Change The Main Surfaces, Their Tessellation Or Their Placement ====//
+void Geom::GetCacheKeyParms( vector< Parm* > & parm_vec )
+{
+    for ( int i = 0 ; i < ( int )m_ParmVec.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( m_ParmVec[i] );
+        if ( !p )
+        {
+            continue;
+        }
+
+        // Analysis settings and computed properties do not shape m_MainSurfVec
+        string gname = p->GetGroupName();
+        if ( gname == "BBox" || gname == "Mass_Props" || gname == "Negative_Volume_Props" ||
+             gname == "ParasiteDragProps" )
+        {
+            continue;
+        }
+
+        parm_vec.push_back( p );
+    }
+}
+
+//==== Placement Parms Computed From The Driving Ones ====//
+void Geom::GetCacheDerivedParms( vector< Parm* > & parm_vec )
+{
+    if ( m_AbsRelFlag() == vsp::REL )
+    {
+        parm_vec.push_back( &m_XLoc );
+        parm_vec.push_back( &m_YLoc );
+        parm_vec.push_back( &m_ZLoc );
+        parm_vec.push_back( &m_XRot );
+        parm_vec.push_back( &m_YRot );
+        parm_vec.push_back( &m_ZRot );
+    }
+    else
+    {
+        parm_vec.push_back( &m_XRelLoc );
+        parm_vec.push_back( &m_YRelLoc );
+        parm_vec.push_back( &m_ZRelLoc );
+        parm_vec.push_back( &m_XRelRot );
+        parm_vec.push_back( &m_YRelRot );
+        parm_vec.push_back( &m_ZRelRot );
+    }
+
+    parm_vec.push_back( m_U01() ? &m_U0NLoc : &m_ULoc );
+    parm_vec.push_back( m_R01() ? &m_R0NLoc : &m_RLoc );
+    parm_vec.push_back( m_L01() ? &m_L0LenLoc : &m_LLoc );
+}
+
+//==== Key Of Everything The Main Surfaces And Tessellation Depend On ====//
+void Geom::BuildCacheKey( vector< double > & key, vector< Parm* > & derived_vec )
+{
+    key.clear();
+    key.push_back( GetType().m_Type );
+    key.push_back( m_ForceXSecFlag );
+
+    derived_vec.clear();
+    GetCacheDerivedParms( derived_vec );
+
+    vector< Parm* > sorted_derived_vec = derived_vec;
+    std::sort( sorted_derived_vec.begin(), sorted_derived_vec.end() );
+
+    vector< Parm* > parm_vec;
+    GetCacheKeyParms( parm_vec );
+
+    for ( int i = 0 ; i < ( int )parm_vec.size() ; i++ )
+    {
+        if ( !std::binary_search( sorted_derived_vec.begin(), sorted_derived_vec.end(), parm_vec[i] ) )
+        {
+            key.push_back( parm_vec[i]->Get() );
+        }
+    }
+
+    //==== Parent Transform And Attachment ====//
+    double mat[16];
+    Geom* parent = m_Vehicle->FindGeom( GetParentID() );
+    key.push_back( parent ? 1.0 : 0.0 );
+    if ( parent )
+    {
+        parent->getModelMatrix().getMat( mat );
+        key.insert( key.end(), mat, mat + 16 );
+    }
+
+    CompAttachMatrix().getMat( mat );
+    key.insert( key.end(), mat, mat + 16 );
+
+    AppendCacheKey( key );
+}
+
+//==== Display Tessellation Is Refined Only In TESS_ADAPT_ALL ====//
+void Geom::UpdateTessAdapt()
+{
+    bool flag = m_TessAdaptMode() == TESS_ADAPT_ALL;
+    for ( int i = 0; i < ( int )m_MainSurfVec.size(); i++ )
+    {
+        m_MainSurfVec[i].SetTessAdapt( m_TessChordTol(), m_TessAngleTol(), flag ? m_TessAdaptLevel() : 0 );
+    }
+    for ( int i = 0; i < ( int )m_SurfVec.size(); i++ )
+    {
+        m_SurfVec[i].SetTessAdapt( m_TessChordTol(), m_TessAngleTol(), flag ? m_TessAdaptLevel() : 0 );
+    }
+}
+
 void Geom::UpdateFeatureLines( )
 {
     for ( int i = 0; i < m_MainSurfVec.size(); i++ )
@@ -5240,12 +5434,18 @@ vector< TMesh* > Geom::CreateTMeshVec() const
 vector< TMesh* > Geom::CreateTMeshVec( const vector<VspSurf> &surf_vec ) const
 {
     vector< TMesh* > TMeshVec;
-    vector< vector<vec3d> > pnts;
-    vector< vector<vec3d> > norms;
-    vector< vector<vec3d> > uw_pnts;
 
     int nsurf = surf_vec.size();
 
+    // The skip flags and cached points of m_SurfVec are shared by every caller, hold the lock
+    // until the TMeshes are built and the flags are reset
+    bool shared_flag = &surf_vec == &m_SurfVec;
+    std::unique_lock< std::mutex > tess_lock( m_AnalysisTessMutex, std::defer_lock );
+    if ( shared_flag )
+    {
+        tess_lock.lock();
+    }
+
     for ( int i = 0 ; i < nsurf; i++ )
     {
         surf_vec[i].ResetUSkip();
@@ -5277,15 +5477,55 @@ vector< TMesh* > Geom::CreateTMeshVec( const vector<VspSurf> &surf_vec ) const
         }
     }
 
+    //==== Adaptive Tessellations Of m_SurfVec Are Kept Until The Next Update ====//
+    bool adapt_flag = m_TessAdaptMode() != TESS_ADAPT_NONE;
+    bool cache_flag = adapt_flag && shared_flag;
+
+    vector< vector< vector< vec3d > > > pnts_vec, norms_vec, uw_pnts_vec;
+    vector< vector< vector< vec3d > > > & tess_pnts = cache_flag ? m_AnalysisPnts : pnts_vec;
+    vector< vector< vector< vec3d > > > & tess_norms = cache_flag ? m_AnalysisNorms : norms_vec;
+    vector< vector< vector< vec3d > > > & tess_uw_pnts = cache_flag ? m_AnalysisUWPnts : uw_pnts_vec;
+
+    if ( !cache_flag || !m_AnalysisTessValid || ( int )tess_pnts.size() != nsurf )
+    {
+        // The display tessellation stays coarse in TESS_ADAPT_ANALYSIS, refine a copy
+        vector< VspSurf > adapt_surf_vec;
+        if ( m_TessAdaptMode() == TESS_ADAPT_ANALYSIS )
+        {
+            adapt_surf_vec = surf_vec;
+            for ( int i = 0 ; i < nsurf ; i++ )
+            {
+                adapt_surf_vec[i].SetTessAdapt( m_TessChordTol(), m_TessAngleTol(), m_TessAdaptLevel() );
+            }
+        }
+        const vector< VspSurf > & tess_surf_vec = adapt_surf_vec.empty() ? surf_vec : adapt_surf_vec;
+
+        tess_pnts.assign( nsurf, vector< vector< vec3d > >() );
+        tess_norms.assign( nsurf, vector< vector< vec3d > >() );
+        tess_uw_pnts.assign( nsurf, vector< vector< vec3d > >() );
+
+        for ( int i = 0 ; i < nsurf ; i++ )
+        {
+            if ( surf_vec[i].GetNumSectU() != 0 && surf_vec[i].GetNumSectW() != 0 )
+            {
+                UpdateTesselate( tess_surf_vec, i, tess_pnts[i], tess_norms[i], tess_uw_pnts[i], false );
+            }
+        }
+
+        if ( cache_flag )
+        {
+            m_AnalysisTessValid = true;
+        }
+    }
+
     for ( int i = 0 ; i < nsurf ; i++ )
     {
+        surf_vec[i].ResetUSkip(); // Done with skip flags.
+
         if ( surf_vec[i].GetNumSectU() != 0 && surf_vec[i].GetNumSectW() != 0 )
         {
-            UpdateTesselate( surf_vec, i, pnts, norms, uw_pnts, false );
-            surf_vec[i].ResetUSkip(); // Done with skip flags.
-
             bool thicksurf = true;
-            CreateTMeshVecFromPts( this, TMeshVec, pnts, norms, uw_pnts,
+            CreateTMeshVecFromPts( this, TMeshVec, tess_pnts[i], tess_norms[i], tess_uw_pnts[i],
                                    i, -1, surf_vec[i].GetSurfType(), surf_vec[i].GetSurfCfdType(), thicksurf, surf_vec[i].GetFlipNormal(), surf_vec[i].GetWMax() );
         }
     }
@@ -5940,3 +6180,109 @@ void GeomXSec::OffsetXSecs( double off )
         }
     }
 }
+
+//==== File Based XSec Curves Hold Points That Are Not Parms ====//
+bool GeomXSec::GetXSecCacheableFlag()
+{
+    for ( int i = 0 ; i < m_XSecSurf.NumXSec() ; i++ )
+    {
+        XSec* xs = m_XSecSurf.FindXSec( i );
+        if ( xs && xs->GetXSecCurve() )
+        {
+            int type = xs->GetXSecCurve()->GetType();
+            if ( type == vsp::XS_FILE_FUSE || type == vsp::XS_FILE_AIRFOIL )
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void GeomXSec::GetCacheKeyParms( vector< Parm* > & parm_vec )
+{
+    Geom::GetCacheKeyParms( parm_vec );
+
+    for ( int i = 0 ; i < m_XSecSurf.NumXSec() ; i++ )
+    {
+        XSec* xs = m_XSecSurf.FindXSec( i );
+        if ( xs )
+        {
+            vector< string > parm_ids;
+            xs->AddLinkableParms( parm_ids );
+
+            for ( int j = 0 ; j < ( int )parm_ids.size() ; j++ )
+            {
+                Parm* p = ParmMgr.FindParm( parm_ids[j] );
+                if ( p )
+                {
+                    parm_vec.push_back( p );
+                }
+            }
+        }
+    }
+}
+
+//==== Unset Skinning, Non-Driver Curve Dimensions And Reference Lengths ====//
+void GeomXSec::GetCacheDerivedParms( vector< Parm* > & parm_vec )
+{
+    Geom::GetCacheDerivedParms( parm_vec );
+
+    for ( int i = 0 ; i < m_XSecSurf.NumXSec() ; i++ )
+    {
+        XSec* xs = m_XSecSurf.FindXSec( i );
+        if ( !xs )
+        {
+            continue;
+        }
+
+        SkinXSec* sxs = dynamic_cast < SkinXSec* > ( xs );
+        if ( sxs )
+        {
+            sxs->AddUnsetParms( parm_vec );
+        }
+
+        FuseXSec* fxs = dynamic_cast < FuseXSec* > ( xs );
+        if ( fxs )
+        {
+            parm_vec.push_back( &fxs->m_RefLength );
+        }
+
+        XSecCurve* xsc = xs->GetXSecCurve();
+        if ( xsc && xsc->m_DriverGroup )
+        {
+            vector< string > driver_ids = xsc->GetDriverParms();
+            for ( int j = 0 ; j < ( int )driver_ids.size() ; j++ )
+            {
+                Parm* p = ParmMgr.FindParm( driver_ids[j] );
+                if ( p && !xsc->m_DriverGroup->IsDriver( j ) )
+                {
+                    parm_vec.push_back( p );
+                }
+            }
+        }
+    }
+}
+
+//==== XSec Count, Curve Types And Driver Choices ====//
+void GeomXSec::AppendCacheKey( vector< double > & key )
+{
+    key.push_back( m_XSecSurf.NumXSec() );
+    key.push_back( m_XSecSurf.GetFlipUD() );
+
+    for ( int i = 0 ; i < m_XSecSurf.NumXSec() ; i++ )
+    {
+        XSec* xs = m_XSecSurf.FindXSec( i );
+        XSecCurve* xsc = xs ? xs->GetXSecCurve() : NULL;
+        if ( xsc )
+        {
+            key.push_back( xsc->GetType() );
+
+            if ( xsc->m_DriverGroup )
+            {
+                vector< int > choices = xsc->m_DriverGroup->GetChoices();
+                key.insert( key.end(), choices.begin(), choices.end() );
+            }
+        }
+    }
+}
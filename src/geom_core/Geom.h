@@ -36,6 +36,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <mutex>
 
 class XSecSurf;
 
@@ -271,6 +272,7 @@ public:
     virtual void UpdateAttachParms();
     virtual void ComposeModelMatrix();
     virtual void ComposeAttachMatrix();
+    virtual Matrix4d CompAttachMatrix();
     virtual void SetCenter( double x, double y, double z )      { m_Center.set_xyz( x, y, z ); }
     virtual void ComputeCenter()
     {
@@ -524,6 +526,10 @@ public:
     virtual xmlNodePtr EncodeGeom( xmlNodePtr & node );
     virtual xmlNodePtr DecodeGeom( xmlNodePtr & node );
 
+    // Large geometry payloads decoded after DecodeXml.  Touches no Parms or
+    // managers, so Vehicle may run it on a worker thread while loading.
+    virtual void DecodeBulkXml( xmlNodePtr & node )                 {}
+
     virtual void ReadV2File( xmlNodePtr &root );
 
     virtual int GetSymFlag() const;
@@ -608,6 +614,12 @@ public:
     IntParm m_TessU;
     LimIntParm m_TessW;
 
+    //==== Adaptive Tessellation ====//
+    IntParm m_TessAdaptMode;
+    Parm m_TessChordTol;
+    Parm m_TessAngleTol;
+    IntParm m_TessAdaptLevel;
+
     IntParm m_SymAncestor;
     BoolParm m_SymAncestOriginFlag;
     IntParm m_SymPlanFlag;
@@ -771,6 +783,17 @@ protected:
 
     virtual void UpdateSurf() = 0;
     void UpdateEndCaps();
+    void UpdateEndCapParms();
+
+    // Geoms whose UpdateSurf through UpdateMainTessVec depend only on the Parms listed by
+    // GetCacheKeyParms, plus anything added by AppendCacheKey, and change no other state may
+    // reuse cached surfaces.  Parms listed by GetCacheDerivedParms are computed by the update,
+    // so they are left out of the key and restored from the cache on a hit.
+    virtual bool GetCacheableFlag()                         { return false; }
+    virtual void GetCacheKeyParms( vector< Parm* > & parm_vec );
+    virtual void GetCacheDerivedParms( vector< Parm* > & parm_vec );
+    virtual void AppendCacheKey( vector< double > & key )   {}
+    void BuildCacheKey( vector< double > & key, vector< Parm* > & derived_vec );
     virtual void UpdateEngine()   {};
     virtual void UpdateFeatureLines();
     virtual void UpdateFlags();
@@ -861,6 +884,7 @@ protected:
     virtual void UpdateHighlightDrawObj()    {};
 
     virtual void UpdatePreTess()   {};
+    void UpdateTessAdapt();
 
     virtual void UpdateMainTessVec( bool firstonly = false );
     virtual void UpdateTessVec();
@@ -895,6 +919,14 @@ protected:
     vector <SimpleTess> m_MainTessVec;
     vector <SimpleTess> m_TessVec;
     vector <SimpleFeatureTess> m_MainFeatureTessVec;
+
+    // Adaptive analysis tessellation of m_SurfVec, built on demand by CreateTMeshVec.
+    // Guarded by m_AnalysisTessMutex along with the m_SurfVec skip flags, CreateTMeshVec may run on several threads at once.
+    mutable std::mutex m_AnalysisTessMutex;
+    mutable bool m_AnalysisTessValid;
+    mutable vector< vector< vector< vec3d > > > m_AnalysisPnts;
+    mutable vector< vector< vector< vec3d > > > m_AnalysisNorms;
+    mutable vector< vector< vector< vec3d > > > m_AnalysisUWPnts;
     vector <SimpleFeatureTess> m_FeatureTessVec;
 
     vector< DegenGeom > m_MainDegenGeomPreviewVec;
@@ -968,6 +1000,12 @@ protected:
     virtual void UpdateDrawObj();
     virtual void UpdateHighlightDrawObj();
 
+    // Cached surfaces also depend on every XSec and XSecCurve, file based curves can not be keyed
+    bool GetXSecCacheableFlag();
+    virtual void GetCacheKeyParms( vector< Parm* > & parm_vec );
+    virtual void GetCacheDerivedParms( vector< Parm* > & parm_vec );
+    virtual void AppendCacheKey( vector< double > & key );
+
     XSecSurf m_XSecSurf;
     vector<DrawObj> m_XSecDrawObj_vec;
     DrawObj m_HighlightXSecDrawObj;
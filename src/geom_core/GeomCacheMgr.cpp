@@ -0,0 +1,109 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// GeomCacheMgr.cpp: implementation of the Geom surface cache.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "GeomCacheMgr.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+//==== Constructor ====//
+GeomCacheMgrSingleton::GeomCacheMgrSingleton()
+{
+    m_MaxSize = 32;
+    m_NumHits = 0;
+    m_NumMisses = 0;
+}
+
+//==== FNV-1a Over The Key Bytes ====//
+size_t GeomCacheMgrSingleton::HashKey( const vector< double > & key )
+{
+    uint64_t h = 14695981039346656037ULL;
+    for ( size_t i = 0 ; i < key.size() ; i++ )
+    {
+        uint64_t bits;
+        std::memcpy( &bits, &key[i], sizeof( bits ) );
+        for ( int b = 0 ; b < 8 ; b++ )
+        {
+            h ^= ( bits >> ( 8 * b ) ) & 0xff;
+            h *= 1099511628211ULL;
+        }
+    }
+    return ( size_t )h;
+}
+
+bool GeomCacheMgrSingleton::Find( GeomCacheEntry & entry )
+{
+    std::lock_guard< std::mutex > lock( m_CacheMutex );
+
+    std::unordered_map< size_t, EntryIter >::iterator it = m_EntryMap.find( HashKey( entry.m_Key ) );
+    if ( it == m_EntryMap.end() || it->second->m_Key != entry.m_Key )
+    {
+        m_NumMisses++;
+        return false;
+    }
+
+    m_EntryList.splice( m_EntryList.begin(), m_EntryList, it->second );
+    entry = m_EntryList.front();
+    m_NumHits++;
+    return true;
+}
+
+void GeomCacheMgrSingleton::Add( const GeomCacheEntry & entry )
+{
+    std::lock_guard< std::mutex > lock( m_CacheMutex );
+
+    if ( m_MaxSize <= 0 )
+    {
+        return;
+    }
+
+    size_t h = HashKey( entry.m_Key );
+
+    //==== Replace Any Entry With The Same Hash ====//
+    std::unordered_map< size_t, EntryIter >::iterator it = m_EntryMap.find( h );
+    if ( it != m_EntryMap.end() )
+    {
+        m_EntryList.erase( it->second );
+        m_EntryMap.erase( it );
+    }
+
+    m_EntryList.push_front( entry );
+    m_EntryMap[h] = m_EntryList.begin();
+
+    Trim();
+}
+
+void GeomCacheMgrSingleton::Clear()
+{
+    std::lock_guard< std::mutex > lock( m_CacheMutex );
+
+    m_EntryList.clear();
+    m_EntryMap.clear();
+    m_NumHits = 0;
+    m_NumMisses = 0;
+}
+
+void GeomCacheMgrSingleton::SetMaxSize( int max_size )
+{
+    std::lock_guard< std::mutex > lock( m_CacheMutex );
+
+    m_MaxSize = std::max( max_size, 0 );
+    Trim();
+}
+
+//==== Drop Least Recently Used Entries Past Max Size ====//
+void GeomCacheMgrSingleton::Trim()
+{
+    while ( ( int )m_EntryList.size() > m_MaxSize )
+    {
+        m_EntryMap.erase( HashKey( m_EntryList.back().m_Key ) );
+        m_EntryList.pop_back();
+    }
+}
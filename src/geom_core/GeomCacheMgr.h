@@ -0,0 +1,93 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// GeomCacheMgr.h: LRU cache of Geom main surfaces and tessellations
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(GEOMCACHEMGR__INCLUDED_)
+#define GEOMCACHEMGR__INCLUDED_
+
+#include "VspSurf.h"
+#include "SimpleTess.h"
+#include "SimpleFeatureTess.h"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using std::vector;
+
+//==== Cached Result Of One Geom Surface Update ====//
+class GeomCacheEntry
+{
+public:
+
+    vector< double > m_Key;             // Everything the surfaces and tessellation depend on
+    vector< double > m_DerivedVals;     // Parms computed by the update, see Geom::GetCacheDerivedParms
+
+    vector< VspSurf > m_MainSurfVec;
+    vector< bool > m_CapUMinSuccess;
+    vector< bool > m_CapUMaxSuccess;
+
+    vector< SimpleTess > m_MainTessVec;
+    vector< SimpleFeatureTess > m_MainFeatureTessVec;
+};
+
+//==== Geom Cache Manager ====//
+// Geoms that opt in look up their key before rebuilding their surfaces, so
+// returning to an earlier set of Parm values ( DOE, optimization, toggling a
+// Parm back and forth ) reuses the earlier surfaces and tessellation.  Keys
+// are compared exactly, the hash only picks the candidate entry.
+class GeomCacheMgrSingleton
+{
+public:
+
+    static GeomCacheMgrSingleton& getInstance()
+    {
+        static GeomCacheMgrSingleton instance;
+        return instance;
+    }
+
+    // Copies the entry matching entry.m_Key into entry and marks it most recently used
+    bool Find( GeomCacheEntry & entry );
+    void Add( const GeomCacheEntry & entry );
+
+    void Clear();                       // Drop all entries and reset statistics
+
+    // Zero disables the cache
+    void SetMaxSize( int max_size );
+    int GetMaxSize()                    { return m_MaxSize; }
+    int GetNumEntries()                 { return ( int )m_EntryList.size(); }
+
+    int GetNumHits()                    { return m_NumHits; }
+    int GetNumMisses()                  { return m_NumMisses; }
+
+private:
+
+    GeomCacheMgrSingleton();
+    GeomCacheMgrSingleton( GeomCacheMgrSingleton const& copy );          // Not Implemented
+    GeomCacheMgrSingleton& operator=( GeomCacheMgrSingleton const& copy ); // Not Implemented
+
+    static size_t HashKey( const vector< double > & key );
+
+    void Trim();
+
+    typedef std::list< GeomCacheEntry >::iterator EntryIter;
+
+    std::list< GeomCacheEntry > m_EntryList;                // Most recently used first
+    std::unordered_map< size_t, EntryIter > m_EntryMap;     // Key hash -> entry
+
+    int m_MaxSize;
+    int m_NumHits;
+    int m_NumMisses;
+
+    std::mutex m_CacheMutex;
+};
+
+#define GeomCacheMgr GeomCacheMgrSingleton::getInstance()
+
+#endif // !defined(GEOMCACHEMGR__INCLUDED_)
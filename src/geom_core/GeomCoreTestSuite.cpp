@@ -7,6 +7,8 @@
 
 #include "GeomCoreTestSuite.h"
 #include "MeshGeom.h"
+#include "AdvLinkExpr.h"
+#include "ParmMgr.h"
 #include <cfloat>  //For DBL_EPSILON
 
 //==== Test GeomXForm ====//
@@ -47,6 +49,73 @@ void GeomCoreTestSuite::ParmTest()
     TEST_ASSERT( bp() );
 }
 
+//==== Test Parm Undo ====//
+void GeomCoreTestSuite::ParmUndoTest()
+{
+    int max_size = ParmMgr.GetUndoMaxSize();
+    ParmMgr.ClearUndo();
+
+    Parm p, q;
+    p.Init( "UndoP", "Group1", NULL, 1.0, -1.0e12, 1.0e12 );
+    q.Init( "UndoQ", "Group1", NULL, 1.0, -1.0e12, 1.0e12 );
+
+    //==== Repeated Sets Coalesce ====//
+    p.SetFromDevice( 2.0 );
+    p.SetFromDevice( 3.0 );
+    p.SetFromDevice( 4.0 );
+    TEST_ASSERT( ParmMgr.GetUndoSize() == 1 );
+    ParmMgr.UnDo();
+    TEST_ASSERT_DELTA( 1.0, p.Get(), 1.0e-12 );
+    TEST_ASSERT( ParmMgr.GetUndoSize() == 0 );
+
+    //==== Drag Sets Are Not Recorded ====//
+    p.SetFromDevice( 5.0, true );
+    TEST_ASSERT( ParmMgr.GetUndoSize() == 0 );
+    p.SetFromDevice( 1.0 );
+
+    //==== Groups Undo As One Step ====//
+    ParmMgr.ClearUndo();
+    q.SetFromDevice( 7.0 );
+    ParmMgr.BeginUndoGroup();
+    p.SetFromDevice( 2.0 );
+    ParmMgr.BeginUndoGroup();
+    q.SetFromDevice( 3.0 );
+    ParmMgr.EndUndoGroup();
+    p.SetFromDevice( 4.0 );
+    ParmMgr.EndUndoGroup();
+    TEST_ASSERT( ParmMgr.GetUndoSize() == 4 );
+    ParmMgr.UnDo();
+    TEST_ASSERT_DELTA( 1.0, p.Get(), 1.0e-12 );
+    TEST_ASSERT_DELTA( 7.0, q.Get(), 1.0e-12 );
+    ParmMgr.UnDo();
+    TEST_ASSERT_DELTA( 1.0, q.Get(), 1.0e-12 );
+
+    //==== Ring Drops Oldest Entries ====//
+    ParmMgr.SetUndoMaxSize( 4 );
+    for ( int i = 0 ; i < 10 ; i++ )
+    {
+        ( i % 2 ? q : p ).SetFromDevice( 10.0 + i );
+    }
+    TEST_ASSERT( ParmMgr.GetUndoSize() == 4 );
+    ParmMgr.SetUndoMaxSize( 2 );
+    TEST_ASSERT( ParmMgr.GetUndoSize() == 2 );
+    ParmMgr.UnDo();
+    TEST_ASSERT_DELTA( 17.0, q.Get(), 1.0e-12 );
+    ParmMgr.UnDo();
+    TEST_ASSERT_DELTA( 16.0, p.Get(), 1.0e-12 );
+    ParmMgr.UnDo();
+    TEST_ASSERT_DELTA( 16.0, p.Get(), 1.0e-12 );
+
+    //==== Recording Off ====//
+    ParmMgr.SetUndoFlag( false );
+    p.SetFromDevice( 20.0 );
+    TEST_ASSERT( ParmMgr.GetUndoSize() == 0 );
+    ParmMgr.SetUndoFlag( true );
+
+    ParmMgr.SetUndoMaxSize( max_size );
+    ParmMgr.ClearUndo();
+}
+
 //==== Test Vehicle ====//
 void GeomCoreTestSuite::VehicleTest()
 {
@@ -186,6 +255,27 @@ void GeomCoreTestSuite::XmlTest()
         TEST_ASSERT( std::abs( dbl_vec[i] - dbl_ret_vec[i] ) < DBL_EPSILON  );
     }
 
+    //==== Binary Blocks Round Trip Exactly ====//
+    vector< double > bin_vec( 300000 );
+    for ( int i = 0 ; i < ( int )bin_vec.size() ; i++ )
+    {
+        bin_vec[i] = 1.0 / ( i + 3.0 ) - 7.0e-5 * i;
+    }
+    XmlUtil::AddBinaryDoubleNode( root, "Bin_Vec_Test", bin_vec );
+    vector< double > bin_ret_vec = XmlUtil::GetBinaryDoubleNode( XmlUtil::GetNode( root, "Bin_Vec_Test", 0 ) );
+    TEST_ASSERT( bin_ret_vec == bin_vec );
+
+    vector< vec3d > pnt_vec;
+    pnt_vec.push_back( vec3d( 1.0 / 3.0, -2.5, 1.0e-12 ) );
+    pnt_vec.push_back( vec3d( 4.0, 5.0 / 7.0, -6.0e8 ) );
+    XmlUtil::AddBinaryVec3dNode( root, "Bin_Pnt_Test", pnt_vec );
+    vector< vec3d > pnt_ret_vec = XmlUtil::GetBinaryVec3dNode( XmlUtil::GetNode( root, "Bin_Pnt_Test", 0 ) );
+    TEST_ASSERT( pnt_ret_vec.size() == pnt_vec.size() );
+    for ( int i = 0 ; i < ( int )pnt_vec.size() ; i++ )
+    {
+        TEST_ASSERT( dist( pnt_vec[i], pnt_ret_vec[i] ) == 0.0 );
+    }
+
     xmlFreeNode( root );
 }
 
@@ -240,6 +330,118 @@ void GeomCoreTestSuite::MeshIOTest()
     veh.CutActiveGeomVec();
 }
 
+//==== Test Native Advanced Link Expressions ====//
+void GeomCoreTestSuite::AdvLinkExprTest()
+{
+    vector< string > in_names;
+    in_names.push_back( "span" );
+    in_names.push_back( "sweep" );
+    vector< string > out_names;
+    out_names.push_back( "x" );
+    out_names.push_back( "y" );
+
+    vector< double > in_vals;
+    in_vals.push_back( 10.0 );
+    in_vals.push_back( 30.0 );
+    vector< double > out_vals;
+
+    AdvLinkExpr expr;
+    string code = "// Tip location\n"
+                  "double half = span / 2;\n"
+                  "x = half * tan( Deg2Rad( sweep ) ) + -1.5e-1;\n"
+                  "y = Max( half, 2.0 ); y *= 2; /* doubled */\n";
+    TEST_ASSERT( expr.Compile( code, in_names, out_names ) );
+    expr.Eval( in_vals, out_vals );
+    TEST_ASSERT( out_vals.size() == 2 );
+    TEST_ASSERT_DELTA( 5.0 * tan( 30.0 * DEG_2_RAD ) - 0.15, out_vals[0], 1.0e-12 );
+    TEST_ASSERT_DELTA( 10.0, out_vals[1], 1.0e-12 );
+
+    //==== Unassigned Outputs Keep Script Default ====//
+    TEST_ASSERT( expr.Compile( "x = pow( span, 2 ) - ( sweep - 1 );", in_names, out_names ) );
+    expr.Eval( in_vals, out_vals );
+    TEST_ASSERT_DELTA( 71.0, out_vals[0], 1.0e-12 );
+    TEST_ASSERT( out_vals[1] == -1.0e15 );
+
+    //==== Anything Beyond Arithmetic Is Left To AngelScript ====//
+    TEST_ASSERT( !expr.Compile( "x = 1 / 2;", in_names, out_names ) );
+    TEST_ASSERT( !expr.Compile( "if ( span > 1 ) { x = 1; }", in_names, out_names ) );
+    TEST_ASSERT( !expr.Compile( "x = span % 2;", in_names, out_names ) );
+    TEST_ASSERT( !expr.Compile( "x = z;", in_names, out_names ) );
+    TEST_ASSERT( !expr.Compile( "x = 1.0f;", in_names, out_names ) );
+    TEST_ASSERT( !expr.IsValid() );
+}
+
+//==== Test Shared Results Blocks ====//
+void GeomCoreTestSuite::ResultsBlockTest()
+{
+    vector< double > dvec( 1000 );
+    for ( int i = 0 ; i < ( int )dvec.size() ; i++ )
+    {
+        dvec[i] = 0.5 * i;
+    }
+
+    //==== Unpublished Results Are Invisible Until Published ====//
+    Results* res = ResultsMgr.NewResults( "Block_Test", "Shared block test." );
+    res->Add( NameValData( "Data", dvec, "Test double vector." ) );
+    TEST_ASSERT( ResultsMgr.GetNumResults( "Block_Test" ) == 0 );
+
+    string id = ResultsMgr.PublishResults( res );
+    TEST_ASSERT( ResultsMgr.GetNumResults( "Block_Test" ) == 1 );
+    TEST_ASSERT( ResultsMgr.FindResultsID( "Block_Test" ) == id );
+
+    //==== Copies And Views Share One Block ====//
+    NameValData copy = res->Find( "Data" );
+    DoubleDataBlock view = ResultsMgr.GetDoubleResultsBlock( id, "Data" );
+    TEST_ASSERT( view.get() == copy.GetDoubleBlock().get() );
+    TEST_ASSERT( &ResultsMgr.GetDoubleResults( id, "Data" ) == view.get() );
+
+    //==== View Outlives Deleted Results ====//
+    ResultsMgr.DeleteResult( id );
+    TEST_ASSERT( !ResultsMgr.ValidResultsID( id ) );
+    TEST_ASSERT( view->size() == dvec.size() );
+    TEST_ASSERT_DELTA( dvec.back(), view->back(), 1.0e-12 );
+
+    //==== Missing Data Gives Empty Block ====//
+    TEST_ASSERT( ResultsMgr.GetDoubleResultsBlock( id, "Data" )->empty() );
+}
+
+//==== Test Indexed Shared-Vertex Mesh ====//
+void GeomCoreTestSuite::IndexMeshTest()
+{
+    Vehicle veh;
+    GeomType type;
+    type.m_Type = POD_GEOM_TYPE;
+    type.m_Name = "POD";
+
+    veh.AddGeom( type );
+    string mesh_id = veh.AddMeshGeom( 0 );
+    MeshGeom* mesh = ( MeshGeom* )veh.FindGeom( mesh_id );
+    TEST_ASSERT( mesh != NULL );
+    if ( !mesh )
+    {
+        return;
+    }
+    mesh->FlattenTMeshVec();
+    TEST_ASSERT( mesh->m_TMeshVec.size() > 0 );
+    TMesh* tm = mesh->m_TMeshVec[0];
+
+    //==== Welding Shares Points Between Tris ====//
+    TIndexMesh imesh;
+    imesh.Build( tm, false, 0.0 );
+    TEST_ASSERT( imesh.NumTris() == ( int )tm->m_TVec.size() );
+    TEST_ASSERT( imesh.NumPnts() > 0 );
+    TEST_ASSERT( imesh.NumPnts() < imesh.NumTris() );
+    TEST_ASSERT_DELTA( imesh.ComputeArea(), tm->ComputeTheoArea(), 1.0e-8 );
+    TEST_ASSERT_DELTA( imesh.ComputeVol(), tm->ComputeTheoVol(), 1.0e-8 );
+
+    //==== TMesh View Uses One Node Per Point ====//
+    TMesh view;
+    imesh.LoadTMesh( &view );
+    TEST_ASSERT( view.m_TVec.size() == tm->m_TVec.size() );
+    TEST_ASSERT( ( int )view.m_NVec.size() == imesh.NumPnts() );
+    TEST_ASSERT_DELTA( view.ComputeTheoVol(), tm->ComputeTheoVol(), 1.0e-8 );
+}
+
 void GeomCoreTestSuite::CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b )
 {
     MeshGeom* mesh_1 = ( MeshGeom* )veh.FindGeom( mesh_a );
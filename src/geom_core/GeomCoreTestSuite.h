@@ -23,19 +23,27 @@ public:
     {
         TEST_ADD( GeomCoreTestSuite::GeomXFormTest )
         TEST_ADD( GeomCoreTestSuite::ParmTest )
+        TEST_ADD( GeomCoreTestSuite::ParmUndoTest )
         TEST_ADD( GeomCoreTestSuite::VehicleTest )
         TEST_ADD( GeomCoreTestSuite::PodTest )
         TEST_ADD( GeomCoreTestSuite::XmlTest )
         TEST_ADD( GeomCoreTestSuite::MeshIOTest )
+        TEST_ADD( GeomCoreTestSuite::AdvLinkExprTest )
+        TEST_ADD( GeomCoreTestSuite::ResultsBlockTest )
+        TEST_ADD( GeomCoreTestSuite::IndexMeshTest )
     }
 
 private:
     void GeomXFormTest();
     void ParmTest();
+    void ParmUndoTest();
     void VehicleTest();
     void PodTest();
     void XmlTest();
     void MeshIOTest();
+    void AdvLinkExprTest();
+    void ResultsBlockTest();
+    void IndexMeshTest();
     void CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b );
     void CompareVec3ds( const vec3d & v1, const vec3d & v2, const char * msg = NULL );
 
@@ -742,10 +742,10 @@ xmlNodePtr LinkMgrSingleton::DecodeXml( xmlNodePtr & node )
     xmlNodePtr linkmgr_node = XmlUtil::GetNode( node, "LinkMgr", 0 );
     if ( linkmgr_node )
     {
-        int num = XmlUtil::GetNumNames( linkmgr_node, "Link" );
-        for ( int i = 0 ; i < num ; i++ )
+        vector< xmlNodePtr > link_nodes = XmlUtil::GetNodeVec( linkmgr_node, "Link" );
+        for ( int i = 0 ; i < ( int )link_nodes.size() ; i++ )
         {
-            xmlNodePtr link_node = XmlUtil::GetNode( linkmgr_node, "Link", i );
+            xmlNodePtr link_node = link_nodes[i];
             if ( link_node )
             {
                 Link* link = new Link();
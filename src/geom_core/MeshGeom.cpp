@@ -18,6 +18,7 @@
 #include "LinkMgr.h"
 #include "Vehicle.h"
 #include "PntNodeMerge.h"
+#include "SweepSlicer.h"
 
 #include "StringUtil.h"
 #include "StlHelper.h"
@@ -25,6 +26,9 @@
 #include "SubSurfaceMgr.h"
 #include "VspUtil.h"
 
+#include <atomic>
+#include <thread>
+
 //==== Constructor =====//
 MeshGeom::MeshGeom( Vehicle* vehicle_ptr ) : Geom( vehicle_ptr )
 {
@@ -118,6 +122,18 @@ xmlNodePtr MeshGeom::DecodeXml( xmlNodePtr & node )
 {
     Geom::DecodeXml( node );
 
+    // Vehicle decodes the TMeshes itself when loading a file.
+    if ( !m_Vehicle || !m_Vehicle->GetDeferBulkDecodeFlag() )
+    {
+        DecodeBulkXml( node );
+    }
+
+    return XmlUtil::GetNode( node, "MeshGeom", 0 );
+}
+
+//==== Decode TMeshes ====//
+void MeshGeom::DecodeBulkXml( xmlNodePtr & node )
+{
     xmlNodePtr mesh_node = XmlUtil::GetNode( node, "MeshGeom", 0 );
     if ( mesh_node )
     {
@@ -128,6 +144,8 @@ xmlNodePtr MeshGeom::DecodeXml( xmlNodePtr & node )
         }
         m_TMeshVec.clear();
 
+        vector< xmlNodePtr > tmesh_nodes = XmlUtil::GetNodeVec( mesh_node, "TMesh" );
+
         xmlNodePtr numMeshes_node = XmlUtil::GetNode( mesh_node, "Num_Meshes", 0 );
         unsigned int numMeshes = 0;
         if ( numMeshes_node )
@@ -136,7 +154,7 @@ xmlNodePtr MeshGeom::DecodeXml( xmlNodePtr & node )
         }
         else
         {
-            numMeshes = XmlUtil::GetNumNames( mesh_node, "TMesh" );
+            numMeshes = tmesh_nodes.size();
         }
 
         m_TMeshVec.resize( numMeshes );
@@ -145,18 +163,15 @@ xmlNodePtr MeshGeom::DecodeXml( xmlNodePtr & node )
         for ( int i = 0 ; i < numMeshes ; i++ )
         {
             m_TMeshVec[i] = new TMesh();
-            xmlNodePtr tmesh_node = XmlUtil::GetNode( mesh_node, "TMesh", i );
-            if ( tmesh_node )
+            if ( i < ( int )tmesh_nodes.size() )
             {
-                m_TMeshVec[i]->DecodeXml( tmesh_node );
+                m_TMeshVec[i]->DecodeXml( tmesh_nodes[i] );
             }
 
             // Load this geom properties into each TMesh
             m_TMeshVec[i]->LoadGeomAttributes( this );
         }
     }
-
-    return mesh_node;
 }
 
 int MeshGeom::ReadXSec( const char* file_name )
@@ -2751,6 +2766,25 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         WaveDragMgr.m_XNorm[islice] = ( ( double )islice / ( double )( numSlices - 1 ) );
     }
 
+    // Tube Slice: Start/End Locations
+    vector<double> tubeslicesX;
+    if ( Flow_vec.size() > 0 ) // Tubes exist, slice just inside them
+    {
+        tubeslicesX.push_back( tubestart + 0.001 );
+        tubeslicesX.push_back( tubeend - 0.001 );
+    }
+    else // Tubes don't exist, slice just outside the aircraft
+    {
+        tubeslicesX.push_back( tubestart - 0.001 );
+        tubeslicesX.push_back( tubeend + 0.001 );
+    }
+
+    if ( WaveDragMgr.m_SweepSliceFlag() )
+    {
+        WaveDragSweepSlice( numSlices, sliceAngle, coneSections, center, tubeslicesX, compIdVec );
+        return;
+    }
+
     //==== Build Slice Mesh Object =====//
     for ( int islice = 0 ; islice < numSlices ; islice++ )
     {
@@ -2800,19 +2834,6 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         }
     }
 
-    // Tube Slice: Start/End Locations
-    vector<double> tubeslicesX;
-    if ( Flow_vec.size() > 0 ) // Tubes exist, slice just inside them
-    {
-        tubeslicesX.push_back( tubestart + 0.001 );
-        tubeslicesX.push_back( tubeend - 0.001 );
-    }
-    else // Tubes don't exist, slice just outside the aircraft
-    {
-        tubeslicesX.push_back( tubestart - 0.001 );
-        tubeslicesX.push_back( tubeend + 0.001 );
-    }
-
     //==== Build Tube Slice Mesh Objects =====//
     for ( int itube = 0 ; itube < tubeslicesX.size() ; itube++ )
     {
@@ -2920,6 +2941,94 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
     }
 }
 
+//==== Wave Drag Areas From A Plane Sweep Instead Of Slice Meshes ====//
+void MeshGeom::WaveDragSweepSlice( int numSlices, double sliceAngle, int coneSections, const vec3d &center,
+                                   const vector< double > &tubeslicesX, const vector< string > &compIdVec )
+{
+    //==== Determine Which Triangles Are Interior/Exterior ====//
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+    }
+
+    // Make ID lookup map.
+    std::map< string, int > compIdMap;
+    for ( int icomp = 0; icomp < compIdVec.size(); icomp++ )
+    {
+        compIdMap[ compIdVec[icomp] ] = icomp;
+    }
+
+    SweepSlicer slicer;
+    slicer.Build( m_TMeshVec, compIdMap );
+
+    //==== Tube Slices ====//
+    vector< vec3d > tube_pnts( tubeslicesX.size() );
+    for ( int itube = 0 ; itube < ( int )tubeslicesX.size() ; itube++ )
+    {
+        tube_pnts[itube].set_xyz( tubeslicesX[itube], center.y(), center.z() );
+    }
+
+    vector< double > tube_areas;
+    vector< vector< double > > tube_comp_areas;
+    slicer.SliceAreas( vec3d( 1, 0, 0 ), tube_pnts, tube_areas, tube_comp_areas );
+    WaveDragMgr.m_InletArea = tube_areas[0];
+    WaveDragMgr.m_ExitArea = tube_areas[1];
+
+    //==== Sweep Each Theta On Its Own Thread ====//
+    std::atomic< int > next_theta( 0 );
+    auto sweep_thetas = [ & ]()
+    {
+        vector< vec3d > pnts( numSlices );
+        vector< double > areas;
+        vector< vector< double > > comp_areas;
+
+        int itheta;
+        while ( ( itheta = next_theta++ ) < coneSections )
+        {
+            double theta = WaveDragMgr.m_ThetaRad[itheta];
+
+            // Same rotations as the slice planes
+            vec3d norm( 1, 0, 0 );
+            norm.rotate_y( cos(-( 0.5*PI-sliceAngle)), sin(-( 0.5*PI-sliceAngle)) );
+            norm.rotate_x( cos(theta), sin(theta) );
+
+            // Slice areas are reported projected to the YZ plane
+            double yzfrac = std::abs( norm.x() );
+
+            for ( int islice = 0 ; islice < numSlices ; islice++ )
+            {
+                double xcenter = WaveDragMgr.m_StartX[itheta] + WaveDragMgr.m_XNorm[islice] * ( WaveDragMgr.m_EndX[itheta] - WaveDragMgr.m_StartX[itheta] );
+                pnts[islice].set_xyz( xcenter, center.y(), center.z() );
+            }
+
+            slicer.SliceAreas( norm, pnts, areas, comp_areas );
+
+            for ( int islice = 0 ; islice < numSlices ; islice++ )
+            {
+                for ( int icomp = 0; icomp < compIdVec.size(); icomp++ )
+                {
+                    WaveDragMgr.m_CompSliceAreaDist[itheta][icomp][islice] = comp_areas[icomp][islice] * yzfrac;
+                }
+                WaveDragMgr.m_SliceAreaDist[itheta][islice] = areas[islice] * yzfrac;
+            }
+        }
+    };
+
+    int num_threads = std::min( coneSections, ( int )std::thread::hardware_concurrency() );
+
+    vector< std::thread > threads;
+    for ( int t = 1 ; t < num_threads ; t++ )
+    {
+        threads.emplace_back( sweep_thetas );
+    }
+    sweep_thetas();
+
+    for ( int t = 0 ; t < ( int )threads.size() ; t++ )
+    {
+        threads[t].join();
+    }
+}
+
 //==== Call After BndBoxes Have Been Create But Before Intersect ====//
 void MeshGeom::MassSlice( vector < DegenGeom > &degenGeom, bool degen, int numSlices, int idir, bool writefile )
 {
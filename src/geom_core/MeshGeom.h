@@ -66,6 +66,7 @@ public:
     */
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
     virtual xmlNodePtr DecodeXml( xmlNodePtr & node );
+    virtual void DecodeBulkXml( xmlNodePtr & node );
 
     double m_TotalTheoArea;
     double m_TotalWetArea;
@@ -157,6 +158,8 @@ public:
     virtual void WaveStartEnd( const double &sliceAngle, const vec3d &center );
     virtual void WaveDragSlice( int numSlices, double sliceAngle, int coneSections,
                              const vector <string> & Flow_vec, bool Symm = false );
+    virtual void WaveDragSweepSlice( int numSlices, double sliceAngle, int coneSections, const vec3d &center,
+                                     const vector< double > &tubeslicesX, const vector< string > &compIdVec );
 
     virtual void MergeRemoveOpenMeshes( MeshInfo* info, bool deleteopen = true );
 
@@ -10,6 +10,8 @@
 #include "ParmMgr.h"
 #include "VspUtil.h"
 
+#include <algorithm>
+
 using std::map;
 using std::string;
 using std::unordered_map;
@@ -20,7 +22,13 @@ ParmMgrSingleton::ParmMgrSingleton()
 {
     m_NumParmChanges = 0;
     m_ChangeCnt = 0;
-    m_LastUndoFlag = false;
+    m_UndoFlag = true;
+    m_UndoHead = 0;
+    m_UndoCount = 0;
+    m_UndoGroupDepth = 0;
+    m_UndoGroupCnt = 0;
+    m_CurUndoGroup = 0;
+    m_UndoRing.resize( 1000 );
     m_LastReset = "";
     m_DirtyFlag = true;
 }
@@ -149,38 +157,115 @@ ParmContainer* ParmMgrSingleton::FindParmContainer( const string & id )
 //==== Add Parm To Undo Stack ====//
 void ParmMgrSingleton::AddToUndoStack( Parm* parm_ptr, bool drag_flag )
 {
-    ParmUndo undo( parm_ptr );
+    if ( drag_flag || !m_UndoFlag || m_UndoRing.empty() )
+    {
+        return;
+    }
 
-    if ( !drag_flag )
+    //==== Coalesce Repeated Sets Of The Same Parm - Keep The Oldest Last Val ====//
+    if ( m_UndoCount > 0 )
     {
-        if ( m_LastUndoFlag )
-            m_ParmUndoStack.push( m_LastUndo );
-        m_LastUndo = undo;
-        m_LastUndoFlag = true;
+        ParmUndo & top = TopUndo();
+        if ( top.GetGroup() == m_CurUndoGroup && top.GetID() == parm_ptr->GetID() )
+        {
+            top.SetVal( parm_ptr->Get() );
+            return;
+        }
     }
+
+    PushUndo( ParmUndo( parm_ptr, m_CurUndoGroup ) );
 }
 
-//==== Add Parm To Undo Stack ====//
+//==== Undo Last Change Or Group Of Changes ====//
 void ParmMgrSingleton::UnDo()
 {
-    if ( m_LastUndoFlag )
+    if ( m_UndoCount == 0 )                     // Nothing To Undo
+    {
+        return;
+    }
+
+    int group = TopUndo().GetGroup();
+    do
+    {
+        ParmUndo top = PopUndo();
+
+        Parm* parm_ptr = FindParm( top.GetID() );
+        if ( parm_ptr )
+        {
+            parm_ptr->SetFromDevice( top.GetLastVal(), true );    // Set Last Val - Don't Add To Stack
+        }
+    }
+    while ( group != 0 && m_UndoCount > 0 && TopUndo().GetGroup() == group );
+}
+
+void ParmMgrSingleton::PushUndo( const ParmUndo & undo )
+{
+    m_UndoRing[ m_UndoHead ] = undo;
+    m_UndoHead = ( m_UndoHead + 1 ) % m_UndoRing.size();
+    if ( m_UndoCount < ( int )m_UndoRing.size() )
+    {
+        m_UndoCount++;
+    }
+}
+
+ParmUndo ParmMgrSingleton::PopUndo()
+{
+    m_UndoHead = ( m_UndoHead + m_UndoRing.size() - 1 ) % m_UndoRing.size();
+    m_UndoCount--;
+    return m_UndoRing[ m_UndoHead ];
+}
+
+void ParmMgrSingleton::SetUndoFlag( bool flag )
+{
+    m_UndoFlag = flag;
+    if ( !m_UndoFlag )
     {
-        m_ParmUndoStack.push( m_LastUndo );
-        m_LastUndoFlag = false;
+        ClearUndo();
     }
+}
 
-    if ( m_ParmUndoStack.size() == 0 )          // Nothing To Undo
+//==== Resize Undo Ring Keeping The Newest Entries ====//
+void ParmMgrSingleton::SetUndoMaxSize( int max_size )
+{
+    max_size = std::max( max_size, 0 );
+    if ( max_size == ( int )m_UndoRing.size() )
     {
         return;
     }
 
-    ParmUndo top = m_ParmUndoStack.top();       // Top Undo
-    m_ParmUndoStack.pop();                      // Remove It
+    int nkeep = std::min( m_UndoCount, max_size );
+    vector< ParmUndo > ring( max_size );
+    for ( int i = nkeep - 1 ; i >= 0 ; i-- )
+    {
+        ring[i] = PopUndo();
+    }
+
+    m_UndoRing.swap( ring );
+    m_UndoCount = nkeep;
+    m_UndoHead = max_size > 0 ? nkeep % max_size : 0;
+}
+
+void ParmMgrSingleton::ClearUndo()
+{
+    m_UndoRing.assign( m_UndoRing.size(), ParmUndo() );
+    m_UndoHead = 0;
+    m_UndoCount = 0;
+}
 
-    Parm* parm_ptr = FindParm( top.GetID() );
-    if ( parm_ptr )
+void ParmMgrSingleton::BeginUndoGroup()
+{
+    if ( m_UndoGroupDepth == 0 )
+    {
+        m_CurUndoGroup = ++m_UndoGroupCnt;
+    }
+    m_UndoGroupDepth++;
+}
+
+void ParmMgrSingleton::EndUndoGroup()
+{
+    if ( m_UndoGroupDepth > 0 && --m_UndoGroupDepth == 0 )
     {
-        parm_ptr->SetFromDevice( top.GetLastVal(), true );    // Set Last Val - Don't Add To Stack
+        m_CurUndoGroup = 0;
     }
 }
 
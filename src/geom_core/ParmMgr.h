@@ -19,9 +19,10 @@
 
 #include <map>
 #include <unordered_map>
-#include <stack>
+#include <vector>
 
 using std::string;
+using std::vector;
 using std::unordered_map;
 using std::unordered_multimap;
 
@@ -33,9 +34,18 @@ private:
     ParmMgrSingleton( ParmMgrSingleton const& copy );          // Not Implemented
     ParmMgrSingleton& operator=( ParmMgrSingleton const& copy ); // Not Implemented
 
-    bool m_LastUndoFlag;
-    ParmUndo m_LastUndo;
-    std::stack< ParmUndo > m_ParmUndoStack;
+    // Undo log is a fixed size ring, the oldest entries are dropped once full
+    bool m_UndoFlag;
+    vector< ParmUndo > m_UndoRing;
+    int m_UndoHead;                 // Index of next entry to write
+    int m_UndoCount;
+    int m_UndoGroupDepth;
+    int m_UndoGroupCnt;
+    int m_CurUndoGroup;             // Group for new entries, zero outside BeginUndoGroup/EndUndoGroup
+
+    ParmUndo & TopUndo()            { return m_UndoRing[ ( m_UndoHead + m_UndoRing.size() - 1 ) % m_UndoRing.size() ]; }
+    void PushUndo( const ParmUndo & undo );
+    ParmUndo PopUndo();
 
     string m_ActiveParmID;
 
@@ -71,6 +81,18 @@ public:
     void AddToUndoStack( Parm* parm_ptr, bool drag_flag );
     void UnDo();
 
+    // Turning undo off also clears the log, use for API and batch sessions
+    void SetUndoFlag( bool flag );
+    bool GetUndoFlag()                      { return m_UndoFlag; }
+    void SetUndoMaxSize( int max_size );
+    int GetUndoMaxSize()                    { return ( int )m_UndoRing.size(); }
+    int GetUndoSize()                       { return m_UndoCount; }
+    void ClearUndo();
+
+    // Changes made between Begin and End are undone as a single step, calls may nest
+    void BeginUndoGroup();
+    void EndUndoGroup();
+
     string ForceRemapID( const string & oldID, int size );
     string RemapID( const string & oldID, const string & suggestID = "" );
     string ResetRemapID( const string & lastReset = "" );
@@ -22,17 +22,21 @@ class ParmUndo
 public:
 
     ParmUndo();
-    ParmUndo( Parm* parm_ptr );
+    ParmUndo( Parm* parm_ptr, int group = 0 );
 
     string GetID()              { return m_ParmID; }
+    double GetVal()             { return m_Val; }
+    void SetVal( double v )     { m_Val = v; }
     double GetLastVal()         { return m_LastVal; }
     void SetLastVal( double v ) { m_LastVal = v; }
+    int GetGroup()              { return m_Group; }
 
 protected:
 
     string m_ParmID;
     double m_Val;
     double m_LastVal;
+    int m_Group;                // Non-zero entries with the same group are undone together
 
 };
 
@@ -257,11 +257,9 @@ xmlNodePtr PtCloudGeom::EncodeXml( xmlNodePtr & node )
     // required too much memory to read in.
     // XmlUtil::AddVectorVec3dNode( ptcloud_node, "Points" , m_Pts );
 
-    xmlNodePtr pt_list_node = xmlNewChild( ptcloud_node, NULL, BAD_CAST "Pt_List", NULL );
-    for ( int i = 0 ; i < ( int ) m_Pts.size() ; i++ )
-    {
-        XmlUtil::AddVec3dNode( pt_list_node, "Pt", m_Pts[i] );
-    }
+    // Per-point "Pt_List" nodes also read slowly, points are now written
+    // as a binary block.  Requires file version 6 ( see CURRENT_FILE_VER ).
+    XmlUtil::AddBinaryVec3dNode( ptcloud_node, "Pt_Data", m_Pts );
 
     return ptcloud_node;
 }
@@ -271,13 +269,33 @@ xmlNodePtr PtCloudGeom::DecodeXml( xmlNodePtr & node )
 {
     Geom::DecodeXml( node );
 
+    // Vehicle decodes the points itself when loading a file.
+    if ( !m_Vehicle || !m_Vehicle->GetDeferBulkDecodeFlag() )
+    {
+        DecodeBulkXml( node );
+    }
+
+    return XmlUtil::GetNode( node, "PtCloudGeom", 0 );
+}
+
+//==== Decode Points ====//
+void PtCloudGeom::DecodeBulkXml( xmlNodePtr & node )
+{
     xmlNodePtr ptcloud_node = XmlUtil::GetNode( node, "PtCloudGeom", 0 );
     if ( ptcloud_node )
     {
         // Read in old encoding if it exists.
         m_Pts = XmlUtil::ExtractVectorVec3dNode( ptcloud_node, "Points" );
 
-        // Read in new encoding if they exist.
+        // Binary block encoding.
+        xmlNodePtr pt_data_node = XmlUtil::GetNode( ptcloud_node, "Pt_Data", 0 );
+        if ( pt_data_node )
+        {
+            vector< vec3d > pts = XmlUtil::GetBinaryVec3dNode( pt_data_node );
+            m_Pts.insert( m_Pts.end(), pts.begin(), pts.end() );
+        }
+
+        // Read in per-point encoding if it exists.
         xmlNodePtr pt_list_node = XmlUtil::GetNode( ptcloud_node, "Pt_List", 0 );
         if ( pt_list_node )
         {
@@ -298,8 +316,6 @@ xmlNodePtr PtCloudGeom::DecodeXml( xmlNodePtr & node )
         }
     }
     InitPts();
-
-    return ptcloud_node;
 }
 
 void PtCloudGeom::SelectPoint( int index )
@@ -39,6 +39,7 @@ public:
 
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
     virtual xmlNodePtr DecodeXml( xmlNodePtr & node );
+    virtual void DecodeBulkXml( xmlNodePtr & node );
 
     void SelectPoint( int index );
     void UnSelectLastSel();
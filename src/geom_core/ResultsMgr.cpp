@@ -33,55 +33,55 @@ NameValData::NameValData( const string & name )
 NameValData::NameValData( const string & name, const int & i_data, const string & doc )
 {
     Init( name, vsp::INT_DATA );
-    m_IntData.push_back( i_data );
+    m_IntData = std::make_shared< const vector< int > >( 1, i_data );
     m_Doc = doc;
 }
 NameValData::NameValData( const string & name, const double & d_data, const string & doc )
 {
     Init( name, vsp::DOUBLE_DATA );
-    m_DoubleData.push_back( d_data );
+    m_DoubleData = std::make_shared< const vector< double > >( 1, d_data );
     m_Doc = doc;
 }
 NameValData::NameValData( const string & name, const string & s_data, const string & doc )
 {
     Init( name, vsp::STRING_DATA );
-    m_StringData.push_back( s_data );
+    m_StringData = std::make_shared< const vector< string > >( 1, s_data );
     m_Doc = doc;
 }
 NameValData::NameValData( const string & name, const vec3d & v_data, const string & doc )
 {
     Init( name, vsp::VEC3D_DATA );
-    m_Vec3dData.push_back( v_data );
+    m_Vec3dData = std::make_shared< const vector< vec3d > >( 1, v_data );
     m_Doc = doc;
 }
 NameValData::NameValData( const string & name, const vector< int > & i_data, const string & doc )
 {
     Init( name, vsp::INT_DATA );
-    m_IntData = i_data;
+    m_IntData = std::make_shared< const vector< int > >( i_data );
     m_Doc = doc;
 }
 NameValData::NameValData( const string & name, const vector< double > & d_data, const string & doc )
 {
     Init( name, vsp::DOUBLE_DATA );
-    m_DoubleData = d_data;
+    m_DoubleData = std::make_shared< const vector< double > >( d_data );
     m_Doc = doc;
 }
 NameValData::NameValData( const string & name, const vector< string > & s_data, const string & doc )
 {
     Init( name, vsp::STRING_DATA );
-    m_StringData = s_data;
+    m_StringData = std::make_shared< const vector< string > >( s_data );
     m_Doc = doc;
 }
 NameValData::NameValData( const string & name, const vector< vec3d > & v_data, const string & doc )
 {
     Init( name, vsp::VEC3D_DATA );
-    m_Vec3dData = v_data;
+    m_Vec3dData = std::make_shared< const vector< vec3d > >( v_data );
     m_Doc = doc;
 }
 NameValData::NameValData( const string &name, const vector< vector< double > > &dmat_data, const string & doc )
 {
     Init( name, vsp::DOUBLE_MATRIX_DATA );
-    m_DoubleMatData = dmat_data;
+    m_DoubleMatData = std::make_shared< const vector< vector< double > > >( dmat_data );
     m_Doc = doc;
 }
 void NameValData::Init( const string & name, int type, int index )
@@ -110,47 +110,79 @@ string NameValData::GetTypeName() const
     }
 }
 
+//==== Data Access - Empty Vector When No Block Has Been Set ====//
+const vector<int> & NameValData::GetIntData() const
+{
+    static const vector<int> empty;
+    return m_IntData ? *m_IntData : empty;
+}
+const vector<double> & NameValData::GetDoubleData() const
+{
+    static const vector<double> empty;
+    return m_DoubleData ? *m_DoubleData : empty;
+}
+const vector<string> & NameValData::GetStringData() const
+{
+    static const vector<string> empty;
+    return m_StringData ? *m_StringData : empty;
+}
+const vector<vec3d> & NameValData::GetVec3dData() const
+{
+    static const vector<vec3d> empty;
+    return m_Vec3dData ? *m_Vec3dData : empty;
+}
+const vector< vector< double > > & NameValData::GetDoubleMatData() const
+{
+    static const vector< vector< double > > empty;
+    return m_DoubleMatData ? *m_DoubleMatData : empty;
+}
+
 int NameValData::GetInt( int i ) const
 {
-    if ( i >= 0 && i < ( int )m_IntData.size() )
+    const vector<int> & data = GetIntData();
+    if ( i >= 0 && i < ( int )data.size() )
     {
-        return m_IntData[i];
+        return data[i];
     }
     return 0;
 }
 double NameValData::GetDouble( int i ) const
 {
-    if ( i >= 0 && i < ( int )m_DoubleData.size() )
+    const vector<double> & data = GetDoubleData();
+    if ( i >= 0 && i < ( int )data.size() )
     {
-        return m_DoubleData[i];
+        return data[i];
     }
     return 0;
 }
 double NameValData::GetDouble( int row, int col ) const
 {
-    if ( row >= 0 && row < ( int )m_DoubleMatData.size() )
+    const vector< vector< double > > & data = GetDoubleMatData();
+    if ( row >= 0 && row < ( int )data.size() )
     {
-        if ( col >= 0 && col < ( int )m_DoubleMatData[row].size() )
+        if ( col >= 0 && col < ( int )data[row].size() )
         {
-            return m_DoubleMatData[row][col];
+            return data[row][col];
         }
     }
     return 0;
 }
 string NameValData::GetString( int i ) const
 {
-    if ( i >= 0 && i < ( int )m_StringData.size() )
+    const vector<string> & data = GetStringData();
+    if ( i >= 0 && i < ( int )data.size() )
     {
-        return m_StringData[i];
+        return data[i];
     }
     return string();
 }
 
 vec3d NameValData::GetVec3d( int i ) const
 {
-    if ( i >= 0 && i < ( int )m_Vec3dData.size() )
+    const vector<vec3d> & data = GetVec3dData();
+    if ( i >= 0 && i < ( int )data.size() )
     {
-        return m_Vec3dData[i];
+        return data[i];
     }
     return vec3d();
 }
@@ -966,12 +998,36 @@ ResultsMgrSingleton::~ResultsMgrSingleton()
 //==== Create and Add Results Object and Return Ptr ====//
 Results* ResultsMgrSingleton::CreateResults( const string & name, const string & doc )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    Results* res_ptr = NewResults( name, doc );
+    PublishResults( res_ptr );
+    return res_ptr;
+}
+
+//==== Create Results Not Yet Visible To Readers ====//
+Results* ResultsMgrSingleton::NewResults( const string & name, const string & doc )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );     // Random ID Generator Is Shared
+
     string id = GenerateRandomID( 7 );
-    Results* res_ptr = new Results( name, id, doc );     // Create Results
+    return new Results( name, id, doc );            // Create Results
+}
 
+//==== Add Completed Results To Manager And Return ID ====//
+string ResultsMgrSingleton::PublishResults( Results* res_ptr )
+{
+    if ( !res_ptr )
+    {
+        return string();
+    }
+
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    string id = res_ptr->GetID();
     m_ResultsMap[id] = res_ptr;                     // Map ID to Ptr
-    m_NameIDMap[name].push_back( id );              // Map Name to Vector of IDs
-    return res_ptr;
+    m_NameIDMap[res_ptr->GetName()].push_back( id );    // Map Name to Vector of IDs
+    return id;
 }
 
 
@@ -1001,6 +1057,8 @@ string ResultsMgrSingleton::CreateGeomResults( const string & geom_id, const str
 //==== Delete All Results ====//
 void ResultsMgrSingleton::DeleteAllResults()
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     //==== Delete All Created Results =====//
     map< string, Results* >::iterator iter;
     for ( iter = m_ResultsMap.begin() ; iter != m_ResultsMap.end() ; ++iter )
@@ -1014,6 +1072,8 @@ void ResultsMgrSingleton::DeleteAllResults()
 //==== Delete All Results ====//
 void ResultsMgrSingleton:: DeleteResult( const string & id )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     //==== Find Name Given ID ====//
     map< string, vector< string > >::iterator iter;
 
@@ -1056,6 +1116,8 @@ void ResultsMgrSingleton:: DeleteResult( const string & id )
 //==== Find The Number of Results Given Name ====//
 int ResultsMgrSingleton::GetNumResults( const string & name )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
 
     if ( iter == m_NameIDMap.end() )
@@ -1069,6 +1131,8 @@ int ResultsMgrSingleton::GetNumResults( const string & name )
 //==== Find Results ID Given Name and Optional Index =====//
 string ResultsMgrSingleton::FindResultsID( const string & name, int index )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
     if ( iter == m_NameIDMap.end() )
     {
@@ -1086,6 +1150,8 @@ string ResultsMgrSingleton::FindResultsID( const string & name, int index )
 //==== Find The Latest Results ID For the Given Name
 string ResultsMgrSingleton::FindLatestResultsID( const string & name )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
     if ( iter == m_NameIDMap.end() )
     {
@@ -1112,6 +1178,8 @@ string ResultsMgrSingleton::FindLatestResultsID( const string & name )
 //==== Find Results Ptr Given ID =====//
 Results* ResultsMgrSingleton::FindResultsPtr( const string & id )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     map< string, Results* >::iterator id_iter = m_ResultsMap.find( id );
 
     if ( id_iter ==  m_ResultsMap.end() )
@@ -1133,6 +1201,8 @@ Results* ResultsMgrSingleton::FindResults( const string & name, int index )
 //==== Get Results TimeStamp Given ID ====//
 time_t ResultsMgrSingleton::GetResultsTimestamp( const string & results_id )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     map< string, Results* >::iterator iter = m_ResultsMap.find( results_id );
 
     if ( iter ==  m_ResultsMap.end() )
@@ -1210,6 +1280,8 @@ string ResultsMgrSingleton::GetResultsEntryDoc( const string & results_id, const
 //==== Get The Names of All Results ====//
 vector< string > ResultsMgrSingleton::GetAllResultsNames()
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     vector< string > name_vec;
     map< string, vector< string > >::iterator iter;
     for ( iter = m_NameIDMap.begin() ; iter != m_NameIDMap.end() ; ++iter )
@@ -1475,6 +1547,82 @@ const vector<vec3d> & ResultsMgrSingleton::GetVec3dResults( const string & resul
     return rd_ptr->GetVec3dData();
 }
 
+//==== Find Data Entry Given Results ID, Name and Index ====//
+NameValData* ResultsMgrSingleton::FindDataPtr( const string & results_id, const string & name, int index )
+{
+    Results* results_ptr = FindResultsPtr( results_id );
+    if ( !results_ptr )
+    {
+        return NULL;
+    }
+    return results_ptr->FindPtr( name, index );
+}
+
+//==== Get Shared Int Block Given Results ID and Name of Data and Index (Default 0) ====//
+IntDataBlock ResultsMgrSingleton::GetIntResultsBlock( const string & results_id, const string & name, int index )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    NameValData* rd_ptr = FindDataPtr( results_id, name, index );
+    if ( !rd_ptr || !rd_ptr->GetIntBlock() )
+    {
+        return std::make_shared< const vector< int > >();
+    }
+    return rd_ptr->GetIntBlock();
+}
+
+//==== Get Shared Double Block Given Results ID and Name of Data and Index (Default 0) ====//
+DoubleDataBlock ResultsMgrSingleton::GetDoubleResultsBlock( const string & results_id, const string & name, int index )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    NameValData* rd_ptr = FindDataPtr( results_id, name, index );
+    if ( !rd_ptr || !rd_ptr->GetDoubleBlock() )
+    {
+        return std::make_shared< const vector< double > >();
+    }
+    return rd_ptr->GetDoubleBlock();
+}
+
+//==== Get Shared Double Matrix Block Given Results ID and Name of Data and Index (Default 0) ====//
+DoubleMatDataBlock ResultsMgrSingleton::GetDoubleMatResultsBlock( const string & results_id, const string & name, int index )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    NameValData* rd_ptr = FindDataPtr( results_id, name, index );
+    if ( !rd_ptr || !rd_ptr->GetDoubleMatBlock() )
+    {
+        return std::make_shared< const vector< vector< double > > >();
+    }
+    return rd_ptr->GetDoubleMatBlock();
+}
+
+//==== Get Shared String Block Given Results ID and Name of Data and Index (Default 0) ====//
+StringDataBlock ResultsMgrSingleton::GetStringResultsBlock( const string & results_id, const string & name, int index )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    NameValData* rd_ptr = FindDataPtr( results_id, name, index );
+    if ( !rd_ptr || !rd_ptr->GetStringBlock() )
+    {
+        return std::make_shared< const vector< string > >();
+    }
+    return rd_ptr->GetStringBlock();
+}
+
+//==== Get Shared Vec3d Block Given Results ID and Name of Data and Index (Default 0) ====//
+Vec3dDataBlock ResultsMgrSingleton::GetVec3dResultsBlock( const string & results_id, const string & name, int index )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    NameValData* rd_ptr = FindDataPtr( results_id, name, index );
+    if ( !rd_ptr || !rd_ptr->GetVec3dBlock() )
+    {
+        return std::make_shared< const vector< vec3d > >();
+    }
+    return rd_ptr->GetVec3dBlock();
+}
+
 //==== Check If Results ID is Valid ====//
 bool ResultsMgrSingleton::ValidResultsID( const string & results_id )
 {
@@ -17,11 +17,23 @@
 #include <list>
 #include <vector>
 #include <string>
+#include <memory>
+#include <mutex>
 
 using std::map;
 using std::vector;
 using std::string;
 
+//==== Immutable, Shared Block Of Results Data ====//
+// Copying a NameValData or handing out a block only bumps a reference count,
+// so large result vectors are never duplicated and stay valid for holders of
+// the block even after the owning Results is deleted.
+typedef std::shared_ptr< const vector< int > > IntDataBlock;
+typedef std::shared_ptr< const vector< double > > DoubleDataBlock;
+typedef std::shared_ptr< const vector< string > > StringDataBlock;
+typedef std::shared_ptr< const vector< vec3d > > Vec3dDataBlock;
+typedef std::shared_ptr< const vector< vector< double > > > DoubleMatDataBlock;
+
 //==== Results Data - Named Vectors Of Ints/Double/Strings or Vec3d ====//
 class NameValData
 {
@@ -55,23 +67,29 @@ public:
         return m_Doc;
     }
 
-    const vector<int> & GetIntData() const
+    const vector<int> & GetIntData() const;
+    const vector<double> & GetDoubleData() const;
+    const vector<string> & GetStringData() const;
+    const vector<vec3d> & GetVec3dData() const;
+    const vector< vector< double > > & GetDoubleMatData() const;
+
+    IntDataBlock GetIntBlock() const
     {
         return m_IntData;
     }
-    const vector<double> & GetDoubleData() const
+    DoubleDataBlock GetDoubleBlock() const
     {
         return m_DoubleData;
     }
-    const vector<string> & GetStringData() const
+    StringDataBlock GetStringBlock() const
     {
         return m_StringData;
     }
-    const vector<vec3d> & GetVec3dData() const
+    Vec3dDataBlock GetVec3dBlock() const
     {
         return m_Vec3dData;
     }
-    const vector< vector< double > > & GetDoubleMatData() const
+    DoubleMatDataBlock GetDoubleMatBlock() const
     {
         return m_DoubleMatData;
     }
@@ -82,25 +100,26 @@ public:
     string GetString( int index ) const;
     vec3d GetVec3d( int index ) const;
 
+    //==== Setting Data Replaces The Block - Existing Views Are Untouched ====//
     void SetIntData( const vector< int > & d )
     {
-        m_IntData = d;
+        m_IntData = std::make_shared< const vector< int > >( d );
     }
     void SetDoubleData( const vector< double > & d )
     {
-        m_DoubleData = d;
+        m_DoubleData = std::make_shared< const vector< double > >( d );
     }
     void SetStringData( const vector< string > & d )
     {
-        m_StringData = d;
+        m_StringData = std::make_shared< const vector< string > >( d );
     }
     void SetVec3dData( const vector< vec3d > & d )
     {
-        m_Vec3dData = d;
+        m_Vec3dData = std::make_shared< const vector< vec3d > >( d );
     }
     void SetDoubleMatData( const vector< vector< double > > & d )
     {
-        m_DoubleMatData = d;
+        m_DoubleMatData = std::make_shared< const vector< vector< double > > >( d );
     }
 
 protected:
@@ -108,11 +127,11 @@ protected:
     string m_Name;
     int m_Type;
     string m_Doc;
-    vector< int > m_IntData;
-    vector< double > m_DoubleData;
-    vector< string > m_StringData;
-    vector< vec3d > m_Vec3dData;
-    vector< vector< double > >  m_DoubleMatData;
+    IntDataBlock m_IntData;
+    DoubleDataBlock m_DoubleData;
+    StringDataBlock m_StringData;
+    Vec3dDataBlock m_Vec3dData;
+    DoubleMatDataBlock m_DoubleMatData;
 
 };
 
@@ -222,6 +241,10 @@ public:
 
     Results* CreateResults( const string & name, const string & doc );                      // Return Results Ptr
 
+    //==== Build Results Off The Manager ( Worker Thread ) Then Publish When Complete ====//
+    Results* NewResults( const string & name, const string & doc );
+    string PublishResults( Results* res_ptr );
+
     string CreateGeomResults( const string & geom_id, const string & name );
 
     void DeleteAllResults();
@@ -254,6 +277,13 @@ public:
     const vector<vector<double> > & GetDoubleMatResults( const string & id, const string & name, int index = 0 );
     const vector<string> & GetStringResults( const string & id, const string & name, int index = 0 );
     const vector<vec3d> & GetVec3dResults( const string & id, const string & name, int index = 0 );
+
+    //==== Zero-Copy Views That Remain Valid If The Results Are Deleted ====//
+    IntDataBlock GetIntResultsBlock( const string & id, const string & name, int index = 0 );
+    DoubleDataBlock GetDoubleResultsBlock( const string & id, const string & name, int index = 0 );
+    DoubleMatDataBlock GetDoubleMatResultsBlock( const string & id, const string & name, int index = 0 );
+    StringDataBlock GetStringResultsBlock( const string & id, const string & name, int index = 0 );
+    Vec3dDataBlock GetVec3dResultsBlock( const string & id, const string & name, int index = 0 );
     time_t GetResultsTimestamp( const string & results_id );
 
     bool ValidResultsID( const string & results_id );
@@ -270,9 +300,14 @@ private:
     ResultsMgrSingleton( ResultsMgrSingleton const& copy );          // Not Implemented
     ResultsMgrSingleton& operator=( ResultsMgrSingleton const& copy ); // Not Implemented
 
+    NameValData* FindDataPtr( const string & id, const string & name, int index );
+
     map< string, Results* > m_ResultsMap;                   // Map ID to Results
     map< string, vector< string > > m_NameIDMap;            // Map Name to ID
 
+    //==== Guards The Maps - Data Blocks Are Immutable And Need No Lock ====//
+    std::recursive_mutex m_ResultsMutex;
+
     //==== Default Return Vectors ====//
     vector< int > m_DefaultIntVec;
     vector< double > m_DefaultDoubleVec;
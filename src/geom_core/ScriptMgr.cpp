@@ -84,6 +84,10 @@ void ScriptMgrSingleton::Init( )
     int r = se->SetMessageCallback( asFUNCTION( MessageCallback ), 0, asCALL_CDECL );
     assert( r >= 0 );
 
+    //==== Pool Contexts - Advanced Links Execute Script On Every Parm Change ====//
+    r = se->SetContextCallbacks( RequestContextCallback, ReturnContextCallback, this );
+    assert( r >= 0 );
+
     //==== Register Addons ====//
     RegisterStdString( m_ScriptEngine );
     RegisterScriptArray( m_ScriptEngine, true );
@@ -286,8 +290,61 @@ int ScriptMgrSingleton::ExecuteScript( const char* module_name, const char* func
         return 1;
     }
 
-    // Create our context, prepare it, and then execute
-    asIScriptContext *ctx = m_ScriptEngine->CreateContext();
+    return ExecuteFunction( func, arg_flag, arg );
+}
+
+//==== Find Function By Declaration And Hold A Reference To It ====//
+asIScriptFunction* ScriptMgrSingleton::FindFunction( const string & module_name, const string & decl )
+{
+    asIScriptModule *mod = m_ScriptEngine->GetModule( module_name.c_str() );
+    if ( !mod )
+    {
+        return NULL;
+    }
+
+    asIScriptFunction *func = mod->GetFunctionByDecl( decl.c_str() );
+    if ( func )
+    {
+        func->AddRef();
+    }
+    return func;
+}
+
+//==== Find Address Of Global Double In Module ====//
+double* ScriptMgrSingleton::FindGlobalDouble( const string & module_name, const string & var_name )
+{
+    asIScriptModule *mod = m_ScriptEngine->GetModule( module_name.c_str() );
+    if ( !mod )
+    {
+        return NULL;
+    }
+
+    int index = mod->GetGlobalVarIndexByName( var_name.c_str() );
+    if ( index < 0 )
+    {
+        return NULL;
+    }
+
+    int type_id = 0;
+    mod->GetGlobalVar( index, NULL, NULL, &type_id );
+    if ( type_id != asTYPEID_DOUBLE )
+    {
+        return NULL;
+    }
+
+    return ( double* ) mod->GetAddressOfGlobalVar( index );
+}
+
+//==== Execute Function With Pooled Context ====//
+int ScriptMgrSingleton::ExecuteFunction( asIScriptFunction* func, bool arg_flag, double arg )
+{
+    if ( !func )
+    {
+        return 1;
+    }
+
+    // Get a context, prepare it, and then execute
+    asIScriptContext *ctx = m_ScriptEngine->RequestContext();
     ctx->Prepare( func );
     if ( arg_flag )
     {
@@ -302,17 +359,41 @@ int ScriptMgrSingleton::ExecuteScript( const char* module_name, const char* func
             // An exception occurred, let the script writer know what happened so it can be corrected.
             printf( "An exception '%s' occurred \n", ctx->GetExceptionString() );
         }
-        ctx->Release();
+        m_ScriptEngine->ReturnContext( ctx );
         return 1;
     }
 
     asDWORD ret = ctx->GetReturnDWord();
     int32_t rval = ret;
 
-    ctx->Release();
+    m_ScriptEngine->ReturnContext( ctx );
     return rval;
 }
 
+//==== Hand Out Idle Context Or Create New One ( Nested Calls ) ====//
+asIScriptContext* ScriptMgrSingleton::RequestContextCallback( asIScriptEngine* se, void* param )
+{
+    ScriptMgrSingleton* mgr = ( ScriptMgrSingleton* ) param;
+
+    if ( mgr->m_ContextPool.size() )
+    {
+        asIScriptContext* ctx = mgr->m_ContextPool.back();
+        mgr->m_ContextPool.pop_back();
+        return ctx;
+    }
+
+    return se->CreateContext();
+}
+
+//==== Return Context To Pool ====//
+void ScriptMgrSingleton::ReturnContextCallback( asIScriptEngine* se, asIScriptContext* ctx, void* param )
+{
+    ScriptMgrSingleton* mgr = ( ScriptMgrSingleton* ) param;
+
+    ctx->Unprepare();
+    mgr->m_ContextPool.push_back( ctx );
+}
+
 //==== Return Script Content Given Module Name ====//
 string ScriptMgrSingleton::FindModuleContent( const string &  module_name )
 {
@@ -1984,6 +2065,16 @@ void ScriptMgrSingleton::RegisterEnums( asIScriptEngine* se )
     r = se->RegisterEnumValue( "SYM_XSEC_TYPE", "SYM_ALL", SYM_ALL );
 
 
+    r = se->RegisterEnum( "TESS_ADAPT_MODE" );
+    assert( r >= 0 );
+    r = se->RegisterEnumValue( "TESS_ADAPT_MODE", "TESS_ADAPT_NONE", TESS_ADAPT_NONE );
+    assert( r >= 0 );
+    r = se->RegisterEnumValue( "TESS_ADAPT_MODE", "TESS_ADAPT_ANALYSIS", TESS_ADAPT_ANALYSIS );
+    assert( r >= 0 );
+    r = se->RegisterEnumValue( "TESS_ADAPT_MODE", "TESS_ADAPT_ALL", TESS_ADAPT_ALL );
+    assert( r >= 0 );
+
+
     r = se->RegisterEnum( "TEMP_UNITS" );
     assert( r >= 0 );
     r = se->RegisterEnumValue( "TEMP_UNITS", "TEMP_UNIT_K", TEMP_UNIT_K );
@@ -2996,6 +3087,22 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 ); // TODO: Example
 
 
+    r = se->RegisterGlobalFunction( "void SetGeomCacheSize( int max_size )", asFUNCTION( vsp::SetGeomCacheSize ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "int GetGeomCacheHits()", asFUNCTION( vsp::GetGeomCacheHits ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "int GetGeomCacheMisses()", asFUNCTION( vsp::GetGeomCacheMisses ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "void ClearGeomCache()", asFUNCTION( vsp::ClearGeomCache ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
     r = se->RegisterGlobalFunction( "void ClearVSPModel()", asFUNCTION( vsp::ClearVSPModel ), asCALL_CDECL );
     assert( r >= 0 );
 
@@ -3145,6 +3252,10 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
 
 
+    r = se->RegisterGlobalFunction( "array<string>@+ ExecAnalyses( array<string>@+ analyses )", asMETHOD( ScriptMgrSingleton, ExecAnalyses ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+
+
     r = se->RegisterGlobalFunction( "int GetNumAnalysisInputData( const string & in analysis, const string & in name )", asFUNCTION( vsp::GetNumAnalysisInputData ), asCALL_CDECL );
     assert( r >= 0 );
 
@@ -3254,6 +3365,10 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 ); // TODO: Example
 
 
+    r = se->RegisterGlobalFunction( "array<double>@+ GetDoubleMatResultsFlat( const string & in id, const string & in name, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetDoubleMatResultsFlat ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+
+
     r = se->RegisterGlobalFunction( "array<string>@+ GetStringResults( const string & in id, const string & in name, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetStringResults ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
     assert( r >= 0 );
 
@@ -3262,6 +3377,10 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
 
 
+    r = se->RegisterGlobalFunction( "array<double>@+ GetVec3dResultsFlat( const string & in id, const string & in name, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetVec3dResultsFlat ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+
+
     r = se->RegisterGlobalFunction( "string CreateGeomResults( const string & in geom_id, const string & in name )", asFUNCTION( vsp::CreateGeomResults ), asCALL_CDECL );
     assert( r >= 0 );
 
@@ -4033,10 +4152,34 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
 
 
+    r = se->RegisterGlobalFunction( "array<double>@+ SetParmValVec( array<string>@+ parm_ids, array<double>@+ vals )", asMETHOD( ScriptMgrSingleton, SetParmValVec ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+
+
     r = se->RegisterGlobalFunction( "double GetParmVal(const string & in parm_id )", asFUNCTIONPR( vsp::GetParmVal, ( const string & ), double ), asCALL_CDECL );
     assert( r >= 0 );
 
 
+    r = se->RegisterGlobalFunction( "array<double>@+ GetParmValVec( array<string>@+ parm_ids )", asMETHOD( ScriptMgrSingleton, GetParmValVec ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "void SetUndoFlag( bool flag )", asFUNCTION( vsp::SetUndoFlag ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "bool GetUndoFlag()", asFUNCTION( vsp::GetUndoFlag ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "void BeginUndoGroup()", asFUNCTION( vsp::BeginUndoGroup ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "void EndUndoGroup()", asFUNCTION( vsp::EndUndoGroup ), asCALL_CDECL );
+    assert( r >= 0 );
+
+
     r = se->RegisterGlobalFunction( "double GetParmVal(const string & in container_id, const string & in name, const string & in group )",
                                     asFUNCTIONPR( vsp::GetParmVal, ( const string &, const string &, const string & ), double ), asCALL_CDECL );
     assert( r >= 0 );
@@ -4432,6 +4575,14 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
 
 
+    r = se->RegisterGlobalFunction( "void CompPntVec(const string & in geom_id, const int & in surf_indx, array<double>@+ us, array<double>@+ ws, array<double>@+ xs, array<double>@+ ys, array<double>@+ zs )", asMETHOD( ScriptMgrSingleton, CompPntVec ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+
+
+    r = se->RegisterGlobalFunction( "void CompNormVec(const string & in geom_id, const int & in surf_indx, array<double>@+ us, array<double>@+ ws, array<double>@+ xs, array<double>@+ ys, array<double>@+ zs )", asMETHOD( ScriptMgrSingleton, CompNormVec ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+
+
     r = se->RegisterGlobalFunction( "void CompVecCurvature01(const string & in geom_id, const int & in surf_indx, array<double>@+ us, array<double>@+ ws, array<double>@+ k1s, array<double>@+ k2s, array<double>@+ kas, array<double>@+ kgs)", asMETHOD( ScriptMgrSingleton, CompVecCurvature01 ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
     assert( r >= 0 );
 
@@ -5005,6 +5156,15 @@ CScriptArray* ScriptMgrSingleton::GetAnalysisInputNames( const string & analysis
     return GetProxyStringArray();
 }
 
+CScriptArray* ScriptMgrSingleton::ExecAnalyses( CScriptArray* analyses )
+{
+    vector < string > analysis_vec;
+    FillSTLVector( analyses, analysis_vec );
+
+    m_ProxyStringArray = vsp::ExecAnalyses( analysis_vec );
+    return GetProxyStringArray();
+}
+
 CScriptArray* ScriptMgrSingleton::GetIntAnalysisInput( const string & analysis, const string & name, int index )
 {
     m_ProxyIntArray = vsp::GetIntAnalysisInput( analysis, name, index );
@@ -5059,6 +5219,12 @@ CScriptArray* ScriptMgrSingleton::GetDoubleMatResults(const string &id, const st
     return GetProxyDoubleMatArray();
 }
 
+CScriptArray* ScriptMgrSingleton::GetDoubleMatResultsFlat( const string & id, const string & name, int index )
+{
+    m_ProxyDoubleArray = vsp::GetDoubleMatResultsFlat( id, name, index );
+    return GetProxyDoubleArray();
+}
+
 CScriptArray* ScriptMgrSingleton::GetStringResults( const string & id, const string & name, int index )
 {
     m_ProxyStringArray = vsp::GetStringResults( id, name, index );
@@ -5071,6 +5237,12 @@ CScriptArray* ScriptMgrSingleton::GetVec3dResults( const string & id, const stri
     return GetProxyVec3dArray();
 }
 
+CScriptArray* ScriptMgrSingleton::GetVec3dResultsFlat( const string & id, const string & name, int index )
+{
+    m_ProxyDoubleArray = vsp::GetVec3dResultsFlat( id, name, index );
+    return GetProxyDoubleArray();
+}
+
 CScriptArray* ScriptMgrSingleton::FindContainers()
 {
     m_ProxyStringArray = vsp::FindContainers();
@@ -5101,6 +5273,27 @@ CScriptArray* ScriptMgrSingleton::GetAllUserParms()
     return GetProxyStringArray();
 }
 
+CScriptArray* ScriptMgrSingleton::SetParmValVec( CScriptArray* parm_ids, CScriptArray* vals )
+{
+    vector < string > in_ids;
+    FillSTLVector( parm_ids, in_ids );
+
+    vector < double > in_vals;
+    FillSTLVector( vals, in_vals );
+
+    m_ProxyDoubleArray = vsp::SetParmValVec( in_ids, in_vals );
+    return GetProxyDoubleArray();
+}
+
+CScriptArray* ScriptMgrSingleton::GetParmValVec( CScriptArray* parm_ids )
+{
+    vector < string > in_ids;
+    FillSTLVector( parm_ids, in_ids );
+
+    m_ProxyDoubleArray = vsp::GetParmValVec( in_ids );
+    return GetProxyDoubleArray();
+}
+
 CScriptArray* ScriptMgrSingleton::GetUpperCSTCoefs( const string & xsec_id )
 {
     m_ProxyDoubleArray = vsp::GetUpperCSTCoefs( xsec_id );
@@ -5589,6 +5782,44 @@ CScriptArray* ScriptMgrSingleton::CompVecNorm01(const string &geom_id, const int
     return GetProxyVec3dArray();
 }
 
+void ScriptMgrSingleton::CompPntVec(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws, CScriptArray* xs, CScriptArray* ys, CScriptArray* zs)
+{
+    vector < double > in_us;
+    FillSTLVector( us, in_us );
+
+    vector < double > in_ws;
+    FillSTLVector( ws, in_ws );
+
+    vector < double > out_xs;
+    vector < double > out_ys;
+    vector < double > out_zs;
+
+    vsp::CompPntVec( geom_id, surf_indx, in_us, in_ws, out_xs, out_ys, out_zs );
+
+    FillASArray( out_xs, xs );
+    FillASArray( out_ys, ys );
+    FillASArray( out_zs, zs );
+}
+
+void ScriptMgrSingleton::CompNormVec(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws, CScriptArray* xs, CScriptArray* ys, CScriptArray* zs)
+{
+    vector < double > in_us;
+    FillSTLVector( us, in_us );
+
+    vector < double > in_ws;
+    FillSTLVector( ws, in_ws );
+
+    vector < double > out_xs;
+    vector < double > out_ys;
+    vector < double > out_zs;
+
+    vsp::CompNormVec( geom_id, surf_indx, in_us, in_ws, out_xs, out_ys, out_zs );
+
+    FillASArray( out_xs, xs );
+    FillASArray( out_ys, ys );
+    FillASArray( out_zs, zs );
+}
+
 void ScriptMgrSingleton::CompVecCurvature01(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws, CScriptArray* k1s, CScriptArray* k2s, CScriptArray* kas, CScriptArray* kgs)
 {
     vector < double > in_us;
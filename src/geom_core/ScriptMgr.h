@@ -64,6 +64,11 @@ public:
 
     int ExecuteScript(  const char* module_name,  const char* function_name, bool arg_flag = false, double arg = 0.0, bool by_decl = true );
 
+    //==== Cached Function Handles - Caller Must Release Returned Function ====//
+    asIScriptFunction* FindFunction( const string & module_name, const string & decl );
+    double* FindGlobalDouble( const string & module_name, const string & var_name );
+    int ExecuteFunction( asIScriptFunction* func, bool arg_flag = false, double arg = 0.0 );
+
     void AddToMessages( const string & msg )                { m_ScriptMessages += msg; }
     void ClearMessages()                                    { m_ScriptMessages.clear(); }
     string GetMessages()                                    { return m_ScriptMessages; }
@@ -121,8 +126,13 @@ private:
     static void RegisterAPI( asIScriptEngine* se );
     static void RegisterUtility( asIScriptEngine* se );
 
+    //==== Reuse Contexts Instead Of Creating One Per Call ====//
+    static asIScriptContext* RequestContextCallback( asIScriptEngine* se, void* param );
+    static void ReturnContextCallback( asIScriptEngine* se, asIScriptContext* ctx, void* param );
+
     //==== Member Variables ====//
     asIScriptEngine* m_ScriptEngine;
+    vector< asIScriptContext* > m_ContextPool;
 //    map< string, CScriptBuilder > m_BuilderMap;
     CScriptBuilder m_ScriptBuilder;
     map< string, string > m_ModuleContentMap;
@@ -171,6 +181,7 @@ private:
 
     CScriptArray* ListAnalysis();
     CScriptArray* GetAnalysisInputNames( const string & analysis );
+    CScriptArray* ExecAnalyses( CScriptArray* analyses );
     CScriptArray* GetIntAnalysisInput( const string & analysis, const string & name, int index );
     CScriptArray* GetDoubleAnalysisInput( const string & analysis, const string & name, int index );
     CScriptArray* GetStringAnalysisInput( const string & analysis, const string & name, int index );
@@ -181,13 +192,17 @@ private:
     CScriptArray* GetIntResults( const string & id, const string & name, int index );
     CScriptArray* GetDoubleResults( const string & id, const string & name, int index );
     CScriptArray* GetDoubleMatResults( const string & id, const string & name, int index );
+    CScriptArray* GetDoubleMatResultsFlat( const string & id, const string & name, int index );
     CScriptArray* GetStringResults( const string & id, const string & name, int index );
     CScriptArray* GetVec3dResults( const string & id, const string & name, int index );
+    CScriptArray* GetVec3dResultsFlat( const string & id, const string & name, int index );
     CScriptArray* FindContainers();
     CScriptArray* FindContainersWithName( const string & name );
     CScriptArray* FindContainerGroupNames( const string & parm_container_id );
     CScriptArray* FindContainerParmIDs( const string & parm_container_id );
     CScriptArray* GetAllUserParms();
+    CScriptArray* SetParmValVec( CScriptArray* parm_ids, CScriptArray* vals );
+    CScriptArray* GetParmValVec( CScriptArray* parm_ids );
     CScriptArray* GetUpperCSTCoefs( const string & xsec_id );
     CScriptArray* GetLowerCSTCoefs( const string & xsec_id );
     CScriptArray* GetBORUpperCSTCoefs( const string & bor_id );
@@ -278,6 +293,8 @@ private:
     CScriptArray* CompVecPnt01(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws);
     CScriptArray* CompVecPntRST(const string &geom_id, const int &surf_indx, CScriptArray* rs, CScriptArray* ss, CScriptArray* ts);
     CScriptArray* CompVecNorm01(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws);
+    void CompPntVec(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws, CScriptArray* xs, CScriptArray* ys, CScriptArray* zs);
+    void CompNormVec(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws, CScriptArray* xs, CScriptArray* ys, CScriptArray* zs);
     void CompVecCurvature01(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws, CScriptArray* k1s, CScriptArray* k2s, CScriptArray* kas, CScriptArray* kgs);
     void ProjVecPnt01(const string &geom_id, const int &surf_indx, CScriptArray* pts, CScriptArray* us, CScriptArray* ws, CScriptArray* ds );
     void ProjVecPnt01Guess(const string &geom_id, const int &surf_indx, CScriptArray* pts, CScriptArray* u0s, CScriptArray* w0s, CScriptArray* us, CScriptArray* ws, CScriptArray* ds );
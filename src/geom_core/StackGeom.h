@@ -68,6 +68,7 @@ protected:
     virtual void ChangeID( string id );
 
     virtual void UpdateSurf();
+    virtual bool GetCacheableFlag()                         { return GetXSecCacheableFlag(); }
     virtual void UpdateTesselate( const vector<VspSurf> &surf_vec, int indx, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &norms, vector< vector< vec3d > > &uw_pnts, bool degen ) const;
     virtual void UpdateSplitTesselate( const vector<VspSurf> &surf_vec, int indx, vector< vector< vector< vec3d > > > &pnts, vector< vector< vector< vec3d > > > &norms ) const;
 
@@ -0,0 +1,259 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+// SweepSlicer.cpp: implementation of the plane-sweep slicer.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "SweepSlicer.h"
+#include "TMesh.h"
+#include "APIDefines.h"
+
+#include <algorithm>
+
+SweepSlicer::SweepSlicer()
+{
+    m_NumComps = 0;
+}
+
+void SweepSlicer::Clear()
+{
+    m_TriVec.clear();
+    m_NumComps = 0;
+}
+
+//==== Kept Flag And Owning Component For A Point Inside The Flagged Meshes ====//
+bool SweepSlicer::ClassifyRegion( const vector< TMesh* > & tmv, const vector< int > & b_types, const vector< bool > & thick_surf,
+                                  const vector< bool > & in_b, const map< string, int > & comp_map, int & comp ) const
+{
+    comp = -1;
+
+    if ( tmv[0]->DecideIgnoreTri( vsp::CFD_STRUCTURE, b_types, thick_surf, in_b ) )
+    {
+        return false;
+    }
+
+    // Same priority rule as DeterIntExtTri
+    int prior = -1;
+    const string * id = NULL;
+    for ( int m = 0 ; m < ( int )tmv.size() ; m++ )
+    {
+        if ( in_b[m] && thick_surf[m] && tmv[m]->m_MassPrior > prior )
+        {
+            id = &tmv[m]->m_OriginGeomID;
+            prior = tmv[m]->m_MassPrior;
+        }
+    }
+
+    if ( id )
+    {
+        map< string, int >::const_iterator it = comp_map.find( *id );
+        if ( it != comp_map.end() )
+        {
+            comp = it->second;
+        }
+    }
+    return true;
+}
+
+void SweepSlicer::Build( const vector< TMesh* > & tmv, const map< string, int > & comp_map )
+{
+    Clear();
+
+    m_NumComps = ( int )comp_map.size();
+
+    int nmesh = ( int )tmv.size();
+    if ( nmesh == 0 )
+    {
+        return;
+    }
+
+    vector < int > b_types( nmesh );
+    vector < bool > thick_surf( nmesh );
+    for ( int m = 0 ; m < nmesh ; m++ )
+    {
+        b_types[m] = tmv[m]->m_SurfCfdType;
+        thick_surf[m] = tmv[m]->m_ThickSurf != 0;
+    }
+
+    vector< bool > in_b;
+    vector< TTri* > leaf_vec;
+
+    for ( int m = 0 ; m < nmesh ; m++ )
+    {
+        // Thin surfaces do not bound any region
+        if ( !thick_surf[m] )
+        {
+            continue;
+        }
+
+        // Orient by the enclosed volume so inward wound meshes still cut correctly
+        double vol = 0.0;
+        leaf_vec.clear();
+        for ( int t = 0 ; t < ( int )tmv[m]->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tmv[m]->m_TVec[t];
+            vol += dot( tri->ComputeCenter(), tri->m_Norm ) * tri->ComputeArea();
+
+            if ( tri->m_SplitVec.size() )
+            {
+                leaf_vec.insert( leaf_vec.end(), tri->m_SplitVec.begin(), tri->m_SplitVec.end() );
+            }
+            else
+            {
+                leaf_vec.push_back( tri );
+            }
+        }
+        double norm_sign = ( vol < 0.0 ) ? -1.0 : 1.0;
+
+        for ( int t = 0 ; t < ( int )leaf_vec.size() ; t++ )
+        {
+            TTri* tri = leaf_vec[t];
+
+            in_b = tri->m_insideSurf;
+            in_b.resize( nmesh, false );
+
+            int comp_out, comp_in;
+            in_b[m] = false;
+            bool kept_out = ClassifyRegion( tmv, b_types, thick_surf, in_b, comp_map, comp_out );
+            in_b[m] = true;
+            bool kept_in = ClassifyRegion( tmv, b_types, thick_surf, in_b, comp_map, comp_in );
+
+            SweepTri st;
+            st.m_KeptSign = ( int )kept_in - ( int )kept_out;
+            st.m_CompIn = comp_in;
+            st.m_CompOut = comp_out;
+
+            if ( st.m_KeptSign == 0 && st.m_CompIn == st.m_CompOut )
+            {
+                continue;
+            }
+
+            st.m_Pnt[0] = tri->m_N0->m_Pnt;
+            st.m_Pnt[1] = tri->m_N1->m_Pnt;
+            st.m_Pnt[2] = tri->m_N2->m_Pnt;
+            st.m_Norm = tri->m_Norm * norm_sign;
+            m_TriVec.push_back( st );
+        }
+    }
+}
+
+//==== Segment Where The Plane Cuts The Tri, Oriented Counterclockwise About norm ====//
+bool SweepSlicer::CutTri( const SweepTri & st, const double d[3], const vec3d & norm, vec3d & a, vec3d & b )
+{
+    vec3d cut[2];
+    int ncut = 0;
+
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        int j = ( i + 1 ) % 3;
+        if ( ( d[i] >= 0.0 ) != ( d[j] >= 0.0 ) )
+        {
+            double t = d[i] / ( d[i] - d[j] );
+            cut[ncut++] = st.m_Pnt[i] + ( st.m_Pnt[j] - st.m_Pnt[i] ) * t;
+        }
+    }
+
+    if ( ncut != 2 )
+    {
+        return false;
+    }
+
+    a = cut[0];
+    b = cut[1];
+    if ( dot( b - a, cross( norm, st.m_Norm ) ) < 0.0 )
+    {
+        std::swap( a, b );
+    }
+    return true;
+}
+
+void SweepSlicer::SliceAreas( const vec3d & norm, const vector< vec3d > & pnt_vec,
+                              vector< double > & area_vec, vector< vector< double > > & comp_area_vec ) const
+{
+    int nplane = ( int )pnt_vec.size();
+    int ntri = ( int )m_TriVec.size();
+
+    area_vec.assign( nplane, 0.0 );
+    comp_area_vec.assign( m_NumComps, vector< double >( nplane, 0.0 ) );
+
+    //==== Plane Offsets Along The Normal ====//
+    vector< double > h( nplane );
+    vector< int > plane_order( nplane );
+    for ( int k = 0 ; k < nplane ; k++ )
+    {
+        h[k] = dot( pnt_vec[k], norm );
+        plane_order[k] = k;
+    }
+    std::sort( plane_order.begin(), plane_order.end(), [ & ]( int i, int j ) { return h[i] < h[j]; } );
+
+    //==== Tri Extents Along The Normal ====//
+    vector< double > dvert( 3 * ntri );
+    vector< double > dmin( ntri ), dmax( ntri );
+    vector< int > tri_order( ntri );
+    for ( int t = 0 ; t < ntri ; t++ )
+    {
+        for ( int i = 0 ; i < 3 ; i++ )
+        {
+            dvert[ 3 * t + i ] = dot( m_TriVec[t].m_Pnt[i], norm );
+        }
+        dmin[t] = std::min( dvert[ 3 * t ], std::min( dvert[ 3 * t + 1 ], dvert[ 3 * t + 2 ] ) );
+        dmax[t] = std::max( dvert[ 3 * t ], std::max( dvert[ 3 * t + 1 ], dvert[ 3 * t + 2 ] ) );
+        tri_order[t] = t;
+    }
+    std::sort( tri_order.begin(), tri_order.end(), [ & ]( int i, int j ) { return dmin[i] < dmin[j]; } );
+
+    //==== Sweep ====//
+    vector< int > active;
+    int next_tri = 0;
+    vec3d a, b;
+    double d[3];
+
+    for ( int ip = 0 ; ip < nplane ; ip++ )
+    {
+        int k = plane_order[ip];
+        double hk = h[k];
+        const vec3d & c = pnt_vec[k];
+
+        while ( next_tri < ntri && dmin[ tri_order[ next_tri ] ] <= hk )
+        {
+            active.push_back( tri_order[ next_tri ] );
+            next_tri++;
+        }
+
+        for ( int i = 0 ; i < ( int )active.size() ; )
+        {
+            int t = active[i];
+            if ( dmax[t] < hk )
+            {
+                active[i] = active.back();
+                active.pop_back();
+                continue;
+            }
+            i++;
+
+            d[0] = dvert[ 3 * t ] - hk;
+            d[1] = dvert[ 3 * t + 1 ] - hk;
+            d[2] = dvert[ 3 * t + 2 ] - hk;
+
+            const SweepTri & st = m_TriVec[t];
+            if ( !CutTri( st, d, norm, a, b ) )
+            {
+                continue;
+            }
+
+            double seg_area = 0.5 * dot( cross( a - c, b - c ), norm );
+
+            area_vec[k] += st.m_KeptSign * seg_area;
+            if ( st.m_CompIn >= 0 )
+            {
+                comp_area_vec[ st.m_CompIn ][k] += seg_area;
+            }
+            if ( st.m_CompOut >= 0 )
+            {
+                comp_area_vec[ st.m_CompOut ][k] -= seg_area;
+            }
+        }
+    }
+}
@@ -0,0 +1,73 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// SweepSlicer.h: Plane-sweep cross sectional areas of intersected meshes
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_SWEEPSLICER__INCLUDED_)
+#define VSP_SWEEPSLICER__INCLUDED_
+
+#include "Vec3d.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+using std::map;
+using std::string;
+using std::vector;
+
+class TMesh;
+
+//==== Sweep Slicer ====//
+// Computes the area a slice plane would keep without building slice meshes.
+// Only the triangles that separate kept from ignored space ( or one owning
+// component from another ) are stored.  Each one cut by a plane adds one
+// edge of the section boundary, and summing ( a - c ) x ( b - c ) over the
+// edges gives the exact section area.  Planes sharing a normal are swept in
+// order so each triangle is only tested against the planes it spans.
+class SweepSlicer
+{
+public:
+    SweepSlicer();
+    virtual ~SweepSlicer()                                          {}
+
+    void Clear();
+
+    // Meshes must already be intersected, split and classified by DeterIntExt.
+    // Regions are kept and assigned to components exactly as a CFD_STRUCTURE
+    // slice would be by SetIgnoreTriFlag and ComputeWaveDragArea.
+    void Build( const vector< TMesh* > & tmv, const map< string, int > & comp_map );
+
+    // Area in the plane through each of pnt_vec with normal norm.
+    // comp_area_vec is indexed [comp][plane].
+    void SliceAreas( const vec3d & norm, const vector< vec3d > & pnt_vec,
+                     vector< double > & area_vec, vector< vector< double > > & comp_area_vec ) const;
+
+    int NumTris() const                                             { return ( int )m_TriVec.size(); }
+    int NumComps() const                                            { return m_NumComps; }
+
+protected:
+
+    struct SweepTri
+    {
+        vec3d m_Pnt[3];
+        vec3d m_Norm;       // Outward from the region on the inside of the mesh
+        int m_KeptSign;     // +1 inside kept, -1 outside kept, 0 same on both sides
+        int m_CompIn;
+        int m_CompOut;
+    };
+
+    bool ClassifyRegion( const vector< TMesh* > & tmv, const vector< int > & b_types, const vector< bool > & thick_surf,
+                         const vector< bool > & in_b, const map< string, int > & comp_map, int & comp ) const;
+
+    static bool CutTri( const SweepTri & st, const double d[3], const vec3d & norm, vec3d & a, vec3d & b );
+
+    vector< SweepTri > m_TriVec;
+    int m_NumComps;
+};
+
+#endif // !defined(VSP_SWEEPSLICER__INCLUDED_)
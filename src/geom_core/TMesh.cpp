@@ -449,7 +449,7 @@ xmlNodePtr TMesh::EncodeXml( xmlNodePtr & node )
 {
     xmlNodePtr tmesh_node = xmlNewChild( node, NULL, BAD_CAST "TMesh", NULL );
     XmlUtil::AddIntNode( tmesh_node, "Num_Tris", ( int )m_TVec.size() );
-    EncodeTriList( tmesh_node );
+    EncodeTriData( tmesh_node );
     return tmesh_node;
 }
 
@@ -469,8 +469,35 @@ xmlNodePtr TMesh::EncodeTriList( xmlNodePtr & node )
     return tri_list_node;
 }
 
+// Binary block of 12 doubles per tri -- N0, N1, N2, Norm.  Files older than
+// version 6 ( see CURRENT_FILE_VER ) only contain Tri_List.
+xmlNodePtr TMesh::EncodeTriData( xmlNodePtr & node )
+{
+    vector< double > data( 12 * m_TVec.size() );
+    int k = 0;
+    for ( int i = 0 ; i < ( int ) m_TVec.size() ; i++ )
+    {
+        const vec3d * pnts[4] = { &m_TVec[i]->m_N0->m_Pnt, &m_TVec[i]->m_N1->m_Pnt, &m_TVec[i]->m_N2->m_Pnt, &m_TVec[i]->m_Norm };
+        for ( int j = 0 ; j < 4 ; j++ )
+        {
+            data[k++] = pnts[j]->x();
+            data[k++] = pnts[j]->y();
+            data[k++] = pnts[j]->z();
+        }
+    }
+    return XmlUtil::AddBinaryDoubleNode( node, "Tri_Data", data );
+}
+
 void TMesh::DecodeXml( xmlNodePtr & node )
 {
+    xmlNodePtr tri_data_node = XmlUtil::GetNode( node, "Tri_Data", 0 );
+    if ( tri_data_node )
+    {
+        DecodeTriData( tri_data_node );
+        return;
+    }
+
+    // Text encoding from older files.
     xmlNodePtr tri_list_node = XmlUtil::GetNode( node, "Tri_List", 0 );
     if ( tri_list_node )
     {
@@ -491,42 +518,53 @@ void TMesh::DecodeXml( xmlNodePtr & node )
 
 void TMesh::DecodeTriList( xmlNodePtr & node, int num_tris )
 {
-    m_TVec.resize( num_tris );
-    vector<vec3d> tri;
-    tri.resize( 4 );
+    TIndexMesh imesh;
+    imesh.m_Pnts.reserve( 3 * num_tris );
+    imesh.m_Tris.reserve( 3 * num_tris );
+    imesh.m_Norms.reserve( num_tris );
+    imesh.m_TagIndex.reserve( num_tris );
 
-    xmlNodePtr iter_node;
-
-    iter_node = node->xmlChildrenNode;
-
-    int i = 0;
+    vector<vec3d> tri;
+    xmlNodePtr iter_node = node->xmlChildrenNode;
     while( iter_node != NULL )
     {
         if ( !xmlStrcmp( iter_node->name, ( const xmlChar * )"Tri" ) )
         {
             tri = XmlUtil::GetVectorVec3dNode( iter_node );
-            m_TVec[i] = new TTri( this );
-            // Create Nodes
-            m_TVec[i]->m_N0 = new TNode();
-            m_TVec[i]->m_N1 = new TNode();
-            m_TVec[i]->m_N2 = new TNode();
+            if ( tri.size() == 4 )
+            {
+                imesh.AddTri( tri[0], tri[1], tri[2], tri[3] );
+            }
+        }
+        iter_node = iter_node->next;
+    }
 
-            m_NVec.push_back( m_TVec[i]->m_N0 );
-            m_NVec.push_back( m_TVec[i]->m_N1 );
-            m_NVec.push_back( m_TVec[i]->m_N2 );
+    // Share one node per welded point.
+    imesh.Weld( 0.0 );
+    imesh.LoadTMesh( this );
+}
 
+void TMesh::DecodeTriData( xmlNodePtr & node )
+{
+    vector< double > data = XmlUtil::GetBinaryDoubleNode( node );
+    int num_tris = data.size() / 12;
 
-            // Insert Data
-            m_TVec[i]->m_N0->m_Pnt = tri[0];
-            m_TVec[i]->m_N1->m_Pnt = tri[1];
-            m_TVec[i]->m_N2->m_Pnt = tri[2];
-            m_TVec[i]->m_Norm = tri[3];
-            tri.clear();
+    TIndexMesh imesh;
+    imesh.m_Pnts.reserve( 3 * num_tris );
+    imesh.m_Tris.reserve( 3 * num_tris );
+    imesh.m_Norms.reserve( num_tris );
+    imesh.m_TagIndex.reserve( num_tris );
 
-            i++;
-        }
-        iter_node = iter_node->next;
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        const double * d = &data[12 * i];
+        imesh.AddTri( vec3d( d[0], d[1], d[2] ), vec3d( d[3], d[4], d[5] ),
+                      vec3d( d[6], d[7], d[8] ), vec3d( d[9], d[10], d[11] ) );
     }
+
+    // Share one node per welded point.
+    imesh.Weld( 0.0 );
+    imesh.LoadTMesh( this );
 }
 
 void TMesh::LoadGeomAttributes( const Geom* geomPtr )
@@ -1380,9 +1418,6 @@ int TMesh::NumVerts()
 
 TTri::TTri( TMesh* tmesh )
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Construct Cnt = %d \n", cnt);
     m_E0 = m_E1 = m_E2 = 0;
     m_N0 = m_N1 = m_N2 = 0;
     m_IgnoreTriFlag = false;
@@ -1394,9 +1429,6 @@ TTri::TTri( TMesh* tmesh )
 
 TTri::~TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Destruct Cnt = %d \n", cnt);
     int i;
 
     //==== Delete Split Edges ====//
@@ -4548,3 +4580,176 @@ void BuildTMeshTris( TMesh *tmesh, bool flipnormal, double wmax )
         }
     }
 }
+
+//==== Indexed Tri Mesh ====//
+void TIndexMesh::Clear()
+{
+    m_Pnts.clear();
+    m_Tris.clear();
+    m_Norms.clear();
+    m_TagIndex.clear();
+    m_TagSets.clear();
+    m_TagSetMap.clear();
+}
+
+int TIndexMesh::FindTagSet( const vector< int > & tags )
+{
+    map< vector< int >, int >::const_iterator it = m_TagSetMap.find( tags );
+    if ( it != m_TagSetMap.end() )
+    {
+        return it->second;
+    }
+
+    int index = ( int )m_TagSets.size();
+    m_TagSets.push_back( tags );
+    m_TagSetMap[ tags ] = index;
+    return index;
+}
+
+void TIndexMesh::AddTri( const vec3d & p0, const vec3d & p1, const vec3d & p2, const vec3d & norm )
+{
+    unsigned int n = ( unsigned int )m_Pnts.size();
+    m_Pnts.push_back( p0 );
+    m_Pnts.push_back( p1 );
+    m_Pnts.push_back( p2 );
+
+    m_Tris.push_back( n );
+    m_Tris.push_back( n + 1 );
+    m_Tris.push_back( n + 2 );
+
+    m_Norms.push_back( norm );
+    m_TagIndex.push_back( FindTagSet( vector< int >() ) );
+}
+
+void TIndexMesh::AddTri( const TTri* tri )
+{
+    AddTri( tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt, tri->m_Norm );
+    m_TagIndex.back() = FindTagSet( tri->m_Tags );
+}
+
+void TIndexMesh::Build( const TMesh* tm, bool trimmed, double tol )
+{
+    Clear();
+
+    m_Pnts.reserve( 3 * tm->m_TVec.size() );
+    m_Tris.reserve( 3 * tm->m_TVec.size() );
+    m_Norms.reserve( tm->m_TVec.size() );
+    m_TagIndex.reserve( tm->m_TVec.size() );
+
+    for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+    {
+        const TTri* tri = tm->m_TVec[t];
+        if ( trimmed && tri->m_SplitVec.size() )
+        {
+            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
+            {
+                if ( !tri->m_SplitVec[s]->m_IgnoreTriFlag )
+                {
+                    AddTri( tri->m_SplitVec[s] );
+                }
+            }
+        }
+        else if ( !trimmed || !tri->m_IgnoreTriFlag )
+        {
+            AddTri( tri );
+        }
+    }
+
+    Weld( tol );
+}
+
+// Merge points closer than tol.  A tol <= 0 is taken relative to the mesh size.
+void TIndexMesh::Weld( double tol )
+{
+    if ( m_Pnts.empty() )
+    {
+        return;
+    }
+
+    if ( tol <= 0.0 )
+    {
+        BndBox bb;
+        bb.Update( m_Pnts );
+        tol = max( bb.GetLargestDist() * 1.0e-10, 1.0e-12 );
+    }
+
+    PntNodeCloud pnCloud;
+    pnCloud.AddPntNodes( m_Pnts );
+    IndexPntNodes( pnCloud, tol );
+
+    vector< vec3d > used_pnts;
+    used_pnts.reserve( pnCloud.m_NumUsedPts );
+    for ( int i = 0 ; i < ( int )m_Pnts.size() ; i++ )
+    {
+        if ( pnCloud.UsedNode( i ) )
+        {
+            used_pnts.push_back( m_Pnts[i] );
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )m_Tris.size() ; i++ )
+    {
+        m_Tris[i] = ( unsigned int )pnCloud.GetNodeUsedIndex( m_Tris[i] );
+    }
+
+    m_Pnts.swap( used_pnts );
+}
+
+void TIndexMesh::LoadTMesh( TMesh* tm ) const
+{
+    for ( int i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+    {
+        delete tm->m_TVec[i];
+    }
+    for ( int i = 0 ; i < ( int )tm->m_NVec.size() ; i++ )
+    {
+        delete tm->m_NVec[i];
+    }
+
+    tm->m_NVec.resize( m_Pnts.size() );
+    for ( int i = 0 ; i < ( int )m_Pnts.size() ; i++ )
+    {
+        TNode* n = new TNode();
+        n->m_Pnt = m_Pnts[i];
+        n->m_ID = i;
+        tm->m_NVec[i] = n;
+    }
+
+    tm->m_TVec.resize( NumTris() );
+    for ( int t = 0 ; t < NumTris() ; t++ )
+    {
+        TTri* tri = new TTri( tm );
+        tri->m_N0 = tm->m_NVec[ m_Tris[3 * t] ];
+        tri->m_N1 = tm->m_NVec[ m_Tris[3 * t + 1] ];
+        tri->m_N2 = tm->m_NVec[ m_Tris[3 * t + 2] ];
+        tri->m_Norm = m_Norms[t];
+        tri->m_Tags = m_TagSets[ m_TagIndex[t] ];
+        tm->m_TVec[t] = tri;
+    }
+}
+
+double TIndexMesh::ComputeArea() const
+{
+    double sum = 0.0;
+    for ( int t = 0 ; t < NumTris() ; t++ )
+    {
+        vec3d p0 = m_Pnts[ m_Tris[3 * t] ];
+        vec3d p1 = m_Pnts[ m_Tris[3 * t + 1] ];
+        vec3d p2 = m_Pnts[ m_Tris[3 * t + 2] ];
+        sum += area( p0, p1, p2 );
+    }
+    return sum;
+}
+
+double TIndexMesh::ComputeVol() const
+{
+    double sum = 0.0;
+    for ( int t = 0 ; t < NumTris() ; t++ )
+    {
+        vec3d p0 = m_Pnts[ m_Tris[3 * t] ];
+        vec3d p1 = m_Pnts[ m_Tris[3 * t + 1] ];
+        vec3d p2 = m_Pnts[ m_Tris[3 * t + 2] ];
+        sum += tetra_volume( p0, p1, p2 );
+    }
+    return sum;
+}
@@ -375,6 +375,8 @@ public:
     virtual void DecodeXml( xmlNodePtr & node );
     virtual xmlNodePtr EncodeTriList( xmlNodePtr & node );
     virtual void DecodeTriList( xmlNodePtr & node, int num_tris );
+    virtual xmlNodePtr EncodeTriData( xmlNodePtr & node );
+    virtual void DecodeTriData( xmlNodePtr & node );
 
     void LoadGeomAttributes( const Geom* geomPtr );
     int  RemoveDegenerate();
@@ -507,6 +509,47 @@ protected:
 
 };
 
+//==== Indexed Tri Mesh ====//
+// Compact shared-vertex form of a TMesh -- contiguous points, three indices
+// per tri, per-tri normal and tag set.  Vertices are welded once when the
+// mesh is built.  The TTri/TNode graph is created from it only where
+// intersection and splitting need it.
+class TIndexMesh
+{
+public:
+    TIndexMesh()                                    {}
+    ~TIndexMesh()                                   {}
+
+    void Clear();
+
+    // Collect tris from a TMesh.  When trimmed is set, use the split tris
+    // and skip ignored tris as the exporters do.
+    void Build( const TMesh* tm, bool trimmed, double tol );
+    void AddTri( const vec3d & p0, const vec3d & p1, const vec3d & p2, const vec3d & norm );
+    void AddTri( const TTri* tri );
+    void Weld( double tol );
+
+    // Replace tris and nodes of tm with a view of this mesh sharing one TNode per point.
+    void LoadTMesh( TMesh* tm ) const;
+
+    double ComputeArea() const;
+    double ComputeVol() const;
+
+    int NumTris() const                             { return ( int )m_Tris.size() / 3; }
+    int NumPnts() const                             { return ( int )m_Pnts.size(); }
+
+    vector< vec3d > m_Pnts;
+    vector< unsigned int > m_Tris;
+    vector< vec3d > m_Norms;
+    vector< int > m_TagIndex;                       // Per-tri index into m_TagSets
+    vector< vector< int > > m_TagSets;
+
+protected:
+    int FindTagSet( const vector< int > & tags );
+
+    map< vector< int >, int > m_TagSetMap;
+};
+
 void CreateTMeshVecFromPts( const Geom * geom,
                             vector < TMesh* > & TMeshVec,
                             const vector< vector<vec3d> > & pnts,
@@ -11,6 +11,9 @@
 #endif
 
 #include <filesystem>
+#include <atomic>
+#include <functional>
+#include <thread>
 
 #include "Vehicle.h"
 
@@ -230,6 +233,8 @@ Vehicle::Vehicle()
     m_STLExportPropMainSurf.Init( "ExportPropMainSurf", "STLSettings", this, false, 0, 1 );
 
     m_UpdatingBBox = false;
+    m_BBoxParmChanges = -1;
+    m_DeferBulkDecodeFlag = false;
     m_BbXLen.Init( "X_Len", "BBox", this, 0, 0, 1e12 );
     m_BbXLen.SetDescript( "X length of vehicle bounding box" );
     m_BbYLen.Init( "Y_Len", "BBox", this, 0, 0, 1e12 );
@@ -516,6 +521,11 @@ void Vehicle::Wype()
     m_GeomTypeVec.clear();
 
     m_BBox = BndBox();
+    m_OrigBBox = BndBox();
+    m_BBoxDirtyGeoms.clear();
+    m_GeomBBoxMap.clear();
+    m_GeomOrigBBoxMap.clear();
+    m_BBoxParmChanges = -1;
 
     m_ExportFileNames.clear();
 
@@ -682,9 +692,8 @@ void Vehicle::ParmChanged( Parm* parm_ptr, int type )
         return;
     }
 
-    m_UpdatingBBox = true;
-    UpdateBBox();
-    m_UpdatingBBox = false;
+    //==== Only Geometry Changes Touch The Box - Settings And Visibility Do Not ====//
+    UpdateDirtyBBox();
 
     if ( parm_ptr == &m_AxisLength )
     {
@@ -1876,13 +1885,14 @@ xmlNodePtr Vehicle::DecodeXml( xmlNodePtr & node )
     xmlNodePtr setnamenode = XmlUtil::GetNode( node, "SetNames", 0 );
     if ( setnamenode )
     {
-        int num = XmlUtil::GetNumNames( setnamenode, "Set" );
+        vector< xmlNodePtr > name_nodes = XmlUtil::GetNodeVec( setnamenode, "Set" );
+        int num = ( int )name_nodes.size();
 
         SetNumUserSets( num - SET_FIRST_USER );
 
         for ( int i = 0; i < num; i++ )
         {
-            xmlNodePtr namenode = XmlUtil::GetNode( setnamenode, "Set", i );
+            xmlNodePtr namenode = name_nodes[i];
             if ( namenode )
             {
                 string name = XmlUtil::ExtractString( namenode );
@@ -1912,10 +1922,21 @@ xmlNodePtr Vehicle::DecodeXmlGeomsOnly( xmlNodePtr & node )
         // Decode label information.
         MeasureMgr.DecodeXml( vehicle_node );
 
-        int num = XmlUtil::GetNumNames( vehicle_node, "Geom" );
-        for ( int i = 0 ; i < num ; i++ )
+        vector< xmlNodePtr > geom_nodes = XmlUtil::GetNodeVec( vehicle_node, "Geom" );
+
+        // Parms and containers are registered with the global managers, so
+        // Geoms are created and decoded serially.  Their bulk geometry data
+        // is decoded afterward in parallel.
+        vector< Geom* > bulk_geom_vec;
+        vector< xmlNodePtr > bulk_node_vec;
+        bulk_geom_vec.reserve( geom_nodes.size() );
+        bulk_node_vec.reserve( geom_nodes.size() );
+
+        m_DeferBulkDecodeFlag = true;
+
+        for ( int i = 0 ; i < ( int )geom_nodes.size() ; i++ )
         {
-            xmlNodePtr geom_node = XmlUtil::GetNode( vehicle_node, "Geom", i );
+            xmlNodePtr geom_node = geom_nodes[i];
             if ( geom_node )
             {
                 xmlNodePtr base_node = XmlUtil::GetNode( geom_node, "GeomBase", 0 );
@@ -1932,6 +1953,9 @@ xmlNodePtr Vehicle::DecodeXmlGeomsOnly( xmlNodePtr & node )
                 {
                     geom->DecodeXml( geom_node );
 
+                    bulk_geom_vec.push_back( geom );
+                    bulk_node_vec.push_back( geom_node );
+
                     if ( geom->GetParentID().compare( "NONE" ) == 0 )
                     {
                         AddGeom( geom );
@@ -1939,6 +1963,10 @@ xmlNodePtr Vehicle::DecodeXmlGeomsOnly( xmlNodePtr & node )
                 }
             }
         }
+
+        m_DeferBulkDecodeFlag = false;
+
+        DecodeGeomBulkXml( bulk_geom_vec, bulk_node_vec );
     }
 
     LinkMgr.DecodeXml( node );
@@ -1950,6 +1978,50 @@ xmlNodePtr Vehicle::DecodeXmlGeomsOnly( xmlNodePtr & node )
     return vehicle_node;
 }
 
+//==== Run func( i ) For i In [0,num) Spread Over Worker Threads ====//
+static void RunOnThreads( int num, const std::function< void( int ) > & func )
+{
+    int num_threads = std::min( num, ( int )std::thread::hardware_concurrency() );
+
+    if ( num_threads <= 1 )
+    {
+        for ( int i = 0 ; i < num ; i++ )
+        {
+            func( i );
+        }
+        return;
+    }
+
+    std::atomic< int > next_index( 0 );
+    vector< std::thread > threads;
+    threads.reserve( num_threads );
+    for ( int t = 0 ; t < num_threads ; t++ )
+    {
+        threads.emplace_back( [ & ]()
+        {
+            int i;
+            while ( ( i = next_index++ ) < num )
+            {
+                func( i );
+            }
+        } );
+    }
+
+    for ( int t = 0 ; t < num_threads ; t++ )
+    {
+        threads[t].join();
+    }
+}
+
+//==== Decode Geom Bulk Data On Worker Threads ====//
+void Vehicle::DecodeGeomBulkXml( const vector< Geom* > & geom_vec, vector< xmlNodePtr > & node_vec )
+{
+    RunOnThreads( ( int )geom_vec.size(), [ & ]( int i )
+    {
+        geom_vec[i]->DecodeBulkXml( node_vec[i] );
+    } );
+}
+
 //==== Write File ====//
 bool Vehicle::WriteXMLFile( const string & file_name, int set )
 {
@@ -2021,6 +2093,11 @@ int Vehicle::ReadXMLFile( const string & file_name )
         return 4;
     }
 
+    if ( m_FileOpenVersion > CURRENT_FILE_VER )
+    {
+        fprintf( stderr, "document written by a newer version of OpenVSP, some data may not be read \n");
+    }
+
     //==== Decode Vehicle from document ====//
     DecodeXml( root );
 
@@ -2083,6 +2160,11 @@ int Vehicle::ReadXMLFileGeomsOnly( const string & file_name )
         return 4;
     }
 
+    if ( m_FileOpenVersion > CURRENT_FILE_VER )
+    {
+        fprintf( stderr, "document written by a newer version of OpenVSP, some data may not be read \n");
+    }
+
     //==== Decode Vehicle from document ====//
     DecodeXmlGeomsOnly( root );
 
@@ -4478,14 +4560,69 @@ BndBox Vehicle::UpdateOrigBBox( int set )
 
 void Vehicle::UpdateBBox()
 {
+    // Explicit request - reload every geom box.
+    m_BBoxParmChanges = -1;
+    UpdateDirtyBBox();
+}
+
+//==== Reload Boxes Of Geoms Updated Since Last Call ====//
+void Vehicle::UpdateDirtyBBox()
+{
+    if ( m_UpdatingBBox )
+    {
+        return;
+    }
+
+    // Geoms added or removed change the parm count, so rebuild everything.
+    bool rebuild = ( m_BBoxParmChanges != ParmMgr.GetNumParmChanges() );
+
+    if ( !rebuild && m_BBoxDirtyGeoms.empty() )
+    {
+        return;
+    }
+
+    m_UpdatingBBox = true;
+
+    if ( rebuild )
+    {
+        m_GeomBBoxMap.clear();
+        m_GeomOrigBBoxMap.clear();
+
+        vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
+        for ( int i = 0 ; i < (int) geom_vec.size() ; i++ )
+        {
+            m_GeomBBoxMap[ geom_vec[i]->GetID() ] = geom_vec[i]->GetBndBox();
+            m_GeomOrigBBoxMap[ geom_vec[i]->GetID() ] = geom_vec[i]->GetOrigBndBox();
+        }
+        m_BBoxParmChanges = ParmMgr.GetNumParmChanges();
+    }
+    else
+    {
+        std::set< string >::iterator it;
+        for ( it = m_BBoxDirtyGeoms.begin() ; it != m_BBoxDirtyGeoms.end() ; ++it )
+        {
+            // Geoms not in the vehicle ( clipboard copies ) are skipped.
+            std::unordered_map< string, BndBox >::iterator bit = m_GeomBBoxMap.find( *it );
+            Geom* geom_ptr = FindGeom( *it );
+            if ( bit != m_GeomBBoxMap.end() && geom_ptr )
+            {
+                bit->second = geom_ptr->GetBndBox();
+                m_GeomOrigBBoxMap[ *it ] = geom_ptr->GetOrigBndBox();
+            }
+        }
+    }
+    m_BBoxDirtyGeoms.clear();
+
     BndBox new_box, o_box;
-    int ngeom;
-    vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
-    ngeom = (int) geom_vec.size();
-    for ( int i = 0 ; i < ngeom ; i++ )
+    int ngeom = (int) m_GeomBBoxMap.size();
+    std::unordered_map< string, BndBox >::iterator bit;
+    for ( bit = m_GeomBBoxMap.begin() ; bit != m_GeomBBoxMap.end() ; ++bit )
     {
-        new_box.Update( geom_vec[i]->GetBndBox() );
-        o_box.Update( geom_vec[i]->GetOrigBndBox() ); // Without scale-dependent stuff
+        new_box.Update( bit->second );
+    }
+    for ( bit = m_GeomOrigBBoxMap.begin() ; bit != m_GeomOrigBBoxMap.end() ; ++bit )
+    {
+        o_box.Update( bit->second ); // Without scale-dependent stuff
     }
 
     if( ngeom > 0 && ( new_box != m_BBox ) )
@@ -4499,9 +4636,15 @@ void Vehicle::UpdateBBox()
         m_BbZMin = new_box.GetMin( 2 );
     }
 
-    if (ngeom > 0 && ( o_box != m_OrigBBox ) ) // Check if it has changed
+    bool orig_changed = ( ngeom > 0 && ( o_box != m_OrigBBox ) ); // Check if it has changed
+
+    m_BBox = new_box;
+    m_OrigBBox = o_box;
+
+    if ( orig_changed )
     {
-        for ( int i = 0 ; i < ngeom ; i++ )
+        vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
+        for ( int i = 0 ; i < (int) geom_vec.size() ; i++ )
         {
             // If so, loop through all Geoms, asking if they are sensitive to overall model scale.
             if ( geom_vec[i]->IsModelScaleSensitive() )
@@ -4513,8 +4656,7 @@ void Vehicle::UpdateBBox()
         }
     }
 
-    m_BBox = new_box;
-    m_OrigBBox = o_box;
+    m_UpdatingBBox = false;
 }
 
 bool Vehicle::GetVisibleBndBox( BndBox &b )
@@ -5431,6 +5573,7 @@ void Vehicle::CreateDegenGeom( int set )
     m_DegenGeomVec.clear();
     m_DegenPtMassVec.clear();
 
+    vector< Geom* > degen_geom_vec;
     vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
     for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
     {
@@ -5451,11 +5594,24 @@ void Vehicle::CreateDegenGeom( int set )
             }
             else
             {
-                geom_vec[i]->CreateDegenGeom( m_DegenGeomVec );
+                degen_geom_vec.push_back( geom_vec[i] );
             }
         }
     }
 
+    // Each Geom only touches its own surfaces and sub-surfaces, so they can
+    // be built side by side and gathered back in Geom order.
+    vector< vector< DegenGeom > > dgs_vec( degen_geom_vec.size() );
+    RunOnThreads( ( int )degen_geom_vec.size(), [ & ]( int i )
+    {
+        degen_geom_vec[i]->CreateDegenGeom( dgs_vec[i] );
+    } );
+
+    for ( int i = 0 ; i < ( int )dgs_vec.size() ; i++ )
+    {
+        m_DegenGeomVec.insert( m_DegenGeomVec.end(), dgs_vec[i].begin(), dgs_vec[i].end() );
+    }
+
     vector< string > active_vec_store = GetActiveGeomVec();
 
     string id = AddMeshGeom( set );
@@ -5535,9 +5691,15 @@ string Vehicle::WriteDegenGeomFile()
                 }
             }
 
-            for ( int i = 0; i < (int)m_DegenGeomVec.size(); i++ )
+            vector< TextBuffer > buf_vec( m_DegenGeomVec.size() );
+            RunOnThreads( ( int )m_DegenGeomVec.size(), [ & ]( int i )
+            {
+                m_DegenGeomVec[i].write_degenGeomCsv_file( buf_vec[i] );
+            } );
+
+            for ( int i = 0; i < (int)buf_vec.size(); i++ )
             {
-                m_DegenGeomVec[i].write_degenGeomCsv_file( file_id );
+                buf_vec[i].Write( file_id );
             }
 
             fclose(file_id);
@@ -5584,9 +5746,15 @@ string Vehicle::WriteDegenGeomFile()
 
             fprintf(file_id, "degenGeom = [];");
 
-            for ( int i = 0, propIdx = 1; i < (int)m_DegenGeomVec.size(); i++, propIdx++ )
+            vector< TextBuffer > buf_vec( m_DegenGeomVec.size() );
+            RunOnThreads( ( int )m_DegenGeomVec.size(), [ & ]( int i )
+            {
+                m_DegenGeomVec[i].write_degenGeomM_file( buf_vec[i] );
+            } );
+
+            for ( int i = 0; i < (int)buf_vec.size(); i++ )
             {
-                m_DegenGeomVec[i].write_degenGeomM_file(file_id);
+                buf_vec[i].Write( file_id );
             }
 
             fclose(file_id);
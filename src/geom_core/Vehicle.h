@@ -35,11 +35,13 @@
 #include <vector>
 #include <deque>
 #include <stack>
+#include <set>
+#include <unordered_map>
 #include <memory>
 
 // File versions must be integers.
 #define MIN_FILE_VER 4 // Lowest file version number for 3.X vsp file
-#define CURRENT_FILE_VER 5 // File version number for 3.X files that this executable writes
+#define CURRENT_FILE_VER 6 // File version number for 3.X files that this executable writes
 
 // We have not made substantial use of this flag to determine file compatibility issues.  However,
 // its use will likely increase going forward.  Most parameters additions and file format changes
@@ -47,6 +49,7 @@
 //
 // 4 -- 3.0      Base 3.X file.
 // 5 -- 3.17.1   Add support for scaling thickness of file-type airfoils.
+// 6 -- 3.41.0   MeshGeom triangles and PtCloudGeom points written as binary Tri_Data / Pt_Data blocks.
 //
 
 #define DEFAULT_SET vsp::SET_TYPE::SET_SHOWN // Default set index
@@ -135,8 +138,10 @@ public:
     GeomType GetGeomType( int index );
     void SetGeomType( int index, const GeomType & type );
 
-    BndBox GetBndBox()                                        { return m_BBox; }
+    BndBox GetBndBox()                                        { UpdateDirtyBBox(); return m_BBox; }
     void UpdateBBox();
+    void UpdateDirtyBBox();
+    void SetGeomBBoxDirty( const string & geom_id )           { m_BBoxDirtyGeoms.insert( geom_id ); }
     BndBox UpdateOrigBBox( int set );
     bool GetVisibleBndBox( BndBox &b );
 
@@ -145,6 +150,8 @@ public:
 
     xmlNodePtr DecodeXmlGeomsOnly( xmlNodePtr & node );
 
+    bool GetDeferBulkDecodeFlag()                             { return m_DeferBulkDecodeFlag; }
+
     bool ExistMesh( int set );
 
     vector < string > GetPtCloudGeoms();
@@ -528,6 +535,16 @@ protected:
     BndBox m_BBox;                              // Bounding Box Around All Geometries
     BndBox m_OrigBBox;
 
+    //==== Per Geom Boxes - Only Geoms Updated Since Last Query Are Reloaded ====//
+    std::set< string > m_BBoxDirtyGeoms;
+    std::unordered_map< string, BndBox > m_GeomBBoxMap;
+    std::unordered_map< string, BndBox > m_GeomOrigBBoxMap;
+    int m_BBoxParmChanges;                      // ParmMgr Change Count When Maps Were Built
+
+    //==== Geom Bulk Data Decoded In Parallel After All Geoms Are Created ====//
+    bool m_DeferBulkDecodeFlag;
+    void DecodeGeomBulkXml( const vector< Geom* > & geom_vec, vector< xmlNodePtr > & node_vec );
+
     void SetApplyAbsIgnoreFlag( const vector< string > &g_vec, bool val );
 
     //==== Primary file name ====//
@@ -38,6 +38,9 @@ WaveDragSingleton::WaveDragSingleton() : ParmContainer()
 
     m_SymmFlag.Init( "SymmFlag", "WaveDrag", this, true, 0, 1 );
 
+    m_SweepSliceFlag.Init( "SweepSliceFlag", "WaveDrag", this, true, 0, 1 );
+    m_SweepSliceFlag.SetDescript( "Compute slice areas with a plane sweep instead of slice meshes" );
+
     //==== Plot Tab ====//
     m_PlaneFlag.Init( "PlaneFlag", "WaveDrag", this, false, 0, 1 );
 
@@ -82,6 +82,7 @@ public:
     Parm m_Sref;
 
     BoolParm m_SymmFlag;
+    BoolParm m_SweepSliceFlag;
 
     // Plot Tab Parms
     IntParm m_ThetaIndex;
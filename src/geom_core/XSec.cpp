@@ -1266,6 +1266,36 @@ void SkinXSec::SetUnsetParms( int irib, const VspSurf &surf )
 
 }
 
+//==== Skinning Parms Left For SetUnsetParms To Compute ====//
+void SkinXSec::AddUnsetParms( vector< Parm* > & parm_vec )
+{
+    BoolParm* set_parms[] = { &m_TopLAngleSet, &m_TopLSlewSet, &m_TopLStrengthSet, &m_TopLCurveSet,
+                              &m_TopRAngleSet, &m_TopRSlewSet, &m_TopRStrengthSet, &m_TopRCurveSet,
+                              &m_RightLAngleSet, &m_RightLSlewSet, &m_RightLStrengthSet, &m_RightLCurveSet,
+                              &m_RightRAngleSet, &m_RightRSlewSet, &m_RightRStrengthSet, &m_RightRCurveSet,
+                              &m_BottomLAngleSet, &m_BottomLSlewSet, &m_BottomLStrengthSet, &m_BottomLCurveSet,
+                              &m_BottomRAngleSet, &m_BottomRSlewSet, &m_BottomRStrengthSet, &m_BottomRCurveSet,
+                              &m_LeftLAngleSet, &m_LeftLSlewSet, &m_LeftLStrengthSet, &m_LeftLCurveSet,
+                              &m_LeftRAngleSet, &m_LeftRSlewSet, &m_LeftRStrengthSet, &m_LeftRCurveSet };
+
+    Parm* val_parms[] = { &m_TopLAngle, &m_TopLSlew, &m_TopLStrength, &m_TopLCurve,
+                          &m_TopRAngle, &m_TopRSlew, &m_TopRStrength, &m_TopRCurve,
+                          &m_RightLAngle, &m_RightLSlew, &m_RightLStrength, &m_RightLCurve,
+                          &m_RightRAngle, &m_RightRSlew, &m_RightRStrength, &m_RightRCurve,
+                          &m_BottomLAngle, &m_BottomLSlew, &m_BottomLStrength, &m_BottomLCurve,
+                          &m_BottomRAngle, &m_BottomRSlew, &m_BottomRStrength, &m_BottomRCurve,
+                          &m_LeftLAngle, &m_LeftLSlew, &m_LeftLStrength, &m_LeftLCurve,
+                          &m_LeftRAngle, &m_LeftRSlew, &m_LeftRStrength, &m_LeftRCurve };
+
+    for ( int i = 0 ; i < 32 ; i++ )
+    {
+        if ( !( *set_parms[i] )() )
+        {
+            parm_vec.push_back( val_parms[i] );
+        }
+    }
+}
+
 void SkinXSec::SetUnsetParms( double t, bool flipslew, int irib, const VspSurf &surf,
         BoolParm &LAngleSet,
         BoolParm &LSlewSet,
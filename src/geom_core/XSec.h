@@ -163,6 +163,7 @@ public:
     virtual rib_data_type GetRib( bool first, bool last );
 
     virtual void SetUnsetParms( int irib, const VspSurf &surf );
+    virtual void AddUnsetParms( vector< Parm* > & parm_vec );
 
     virtual void SetUnsetParms( double t, bool flipslew, int irib, const VspSurf &surf,
             BoolParm &LAngleSet,
@@ -194,6 +194,14 @@ void GuiDevice::Init( VspScreen* screen )
     m_Screen = screen;
 }
 
+//==== Widget Callback - Parm Changes From One GUI Action Undo As One Step ====//
+void GuiDevice::StaticDeviceCB( Fl_Widget *w, void* data )
+{
+    ParmMgr.BeginUndoGroup();
+    static_cast< GuiDevice* >( data )->DeviceCB( w );
+    ParmMgr.EndUndoGroup();
+}
+
 //==== Add Widget ====//
 void GuiDevice::AddWidget( Fl_Widget* w, bool resizable_flag )
 {
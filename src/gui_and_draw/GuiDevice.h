@@ -162,10 +162,7 @@ public:
     virtual int  GetIndex()             { return m_Index; }
 
     virtual void DeviceCB( Fl_Widget* w ) = 0;
-    static void StaticDeviceCB( Fl_Widget *w, void* data )
-    {
-        static_cast< GuiDevice* >( data )->DeviceCB( w );
-    }
+    static void StaticDeviceCB( Fl_Widget *w, void* data );
 
 protected:
 
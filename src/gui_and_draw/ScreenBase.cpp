@@ -385,6 +385,13 @@ GeomScreen::GeomScreen( ScreenMgr* mgr, int w, int h, const string & title, cons
     m_GenLayout.AddSlider( m_NumUSlider, "Num_U", 100, " %5.0f" );
     m_GenLayout.AddSlider( m_NumWSlider, "Num_W", 100, " %5.0f" );
 
+    m_TessAdaptChoice.AddItem( "None", vsp::TESS_ADAPT_NONE );
+    m_TessAdaptChoice.AddItem( "Analysis", vsp::TESS_ADAPT_ANALYSIS );
+    m_TessAdaptChoice.AddItem( "All", vsp::TESS_ADAPT_ALL );
+    m_GenLayout.AddChoice( m_TessAdaptChoice, "Adapt" );
+    m_GenLayout.AddSlider( m_TessChordTolSlider, "Chord Tol", 0.01, " %7.5f" );
+    m_GenLayout.AddSlider( m_TessAngleTolSlider, "Angle Tol", 45, " %5.1f" );
+
     m_GenLayout.AddYGap();
 
     //=== Negative Volumes ===//
@@ -1180,6 +1187,9 @@ bool GeomScreen::Update()
 
     m_NumUSlider.Update( geom_ptr->m_TessU.GetID() );
     m_NumWSlider.Update( geom_ptr->m_TessW.GetID() );
+    m_TessAdaptChoice.Update( geom_ptr->m_TessAdaptMode.GetID() );
+    m_TessChordTolSlider.Update( geom_ptr->m_TessChordTol.GetID() );
+    m_TessAngleTolSlider.Update( geom_ptr->m_TessAngleTol.GetID() );
 
     //==== Set Browser ====//
     vector< string > set_name_vec = m_ScreenMgr->GetVehiclePtr()->GetSetNameVec();
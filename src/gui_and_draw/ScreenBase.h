@@ -223,6 +223,9 @@ public:
     //==== Tessellation ====//
     SliderInput m_NumUSlider;
     SliderInput m_NumWSlider;
+    Choice m_TessAdaptChoice;
+    SliderInput m_TessChordTolSlider;
+    SliderInput m_TessAngleTolSlider;
 
     //==== Negative Volume Props ====//
     ToggleButton m_NegativeVolumeBtn;
@@ -31,8 +31,78 @@ IS_GUI_RUNNING_DOC = """
     \"\"\"
 """
 
+CALL_BATCH_DOC = """
+    \"\"\"
+    Calls a list of API functions in order and returns the list of their results.  Through the facade the
+    whole list is sent to the server in one message.  Inside a Batch block the calls are queued in order with
+    the rest of the block and None is returned.
+
+
+    .. code-block:: python
+
+        results = CallBatch( [ ["SetParmVal", (parm_id, 2.0), {}], ["Update", (), {}] ] )
+
+    \"\"\"
+"""
+SET_PARM_VALS_DOC = """
+    \"\"\"
+    Sets the value of each Parm in parm_ids to the matching entry of vals with SetParmValVec and returns the
+    list of values set.  Inside a Batch block the call is queued and None is returned.
+
+
+    .. code-block:: python
+
+        SetParmVals( [ span_id, chord_id ], [ 20.0, 3.0 ] )
+
+    \"\"\"
+"""
+GET_PARM_VALS_DOC = """
+    \"\"\"
+    Returns the list of values of each Parm in parm_ids from GetParmValVec.  Inside a Batch block the call is
+    queued and None is returned.
+
+
+    .. code-block:: python
+
+        vals = GetParmVals( [ span_id, chord_id ] )
+
+    \"\"\"
+"""
+BATCH_DOC = """
+    \"\"\"
+    Context manager that queues facade calls and sends them to the server in one message when the block
+    exits.  Calls inside the block return None; their results are in the results list afterwards.  Without
+    the facade the calls run immediately and results is None.
+
+
+    .. code-block:: python
+
+        with Batch() as batch:
+            for parm_id, val in zip( parm_ids, vals ):
+                SetParmVal( parm_id, val )
+            Update()
+
+    \"\"\"
+"""
+
 PLACEHOLDER_FUNCS = "# **Placeholder start**\n" + "def IsFacade():" + IS_FACADE_DOC + "\n    return False\n"
 PLACEHOLDER_FUNCS += "def IsGUIRunning():" + IS_GUI_RUNNING_DOC + "\n    return False\n"
+PLACEHOLDER_FUNCS += "def CallBatch(calls):" + CALL_BATCH_DOC + """
+    return [globals()[func_name](*args, **kwargs) for func_name, args, kwargs in calls]
+"""
+PLACEHOLDER_FUNCS += "def SetParmVals(parm_ids, vals):" + SET_PARM_VALS_DOC + """
+    return list(SetParmValVec(list(parm_ids), list(vals)))
+"""
+PLACEHOLDER_FUNCS += "def GetParmVals(parm_ids):" + GET_PARM_VALS_DOC + """
+    return list(GetParmValVec(list(parm_ids)))
+"""
+PLACEHOLDER_FUNCS += "class Batch:" + BATCH_DOC + """
+    def __enter__(self):
+        self.results = None
+        return self
+    def __exit__(self, exc_type, exc_value, tb):
+        return False
+"""
 
 CLIENT = r"""
 # Facade Code
@@ -43,7 +113,7 @@ import socket
 from time import sleep
 import subprocess
 import pickle
-from openvsp.facade_server import pack_data, unpack_data
+from openvsp.facade_server import pack_data, unpack_data, unpack_results, send_msg, recv_msg
 from traceback import format_exception
 import openvsp_config
 
@@ -56,8 +126,12 @@ proc = subprocess.Popen([sys.executable, server_file, str(openvsp_config.LOAD_GR
 sleep(1)
 
 sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
 sock.connect((HOST, PORT))
 
+# calls queued by an open Batch block, None when not batching
+_batch_calls = None
+
 def _exception_hook(exc_type, exc_value, tb):
     regular_traceback = []
     facade_traceback = []
@@ -81,30 +155,58 @@ def _exception_hook(exc_type, exc_value, tb):
     for line in regular_traceback:
         print(line)
 
-# function to send and recieve data from the facade server
-def _send_recieve(func_name, args, kwargs):
-    b_data = pack_data([func_name, args, kwargs], True)
-    sock.sendall(b_data)
-    result = None
-    b_result = []
-    while True:
-        packet = sock.recv(202400)
-        if not packet: break
-        b_result.append(packet)
-        try:
-            result = unpack_data(b_result)
-            break
-        except:
-            pass
-    if isinstance(result, list) and result[0] == "error":
+def _check_error(result):
+    if isinstance(result, list) and len(result) > 0 and result[0] == "error":
         sys.excepthook = _exception_hook
         raise Exception(result[1])
+
+# function to send and recieve data from the facade server
+def _send_recieve(func_name, args, kwargs):
+    if _batch_calls is not None:
+        _batch_calls.append([func_name, args, kwargs])
+        return None
+    send_msg(sock, pack_data([func_name, args, kwargs], True))
+    result = unpack_data(recv_msg(sock))
+    _check_error(result)
     return result
 
 def IsFacade():"""+IS_FACADE_DOC+r"""
     return True
 def IsGUIRunning():"""+IS_GUI_RUNNING_DOC+r"""
     return _send_recieve('IsGUIRunning', [], {})
+def CallBatch(calls):"""+CALL_BATCH_DOC+r"""
+    calls = [[func_name, args, kwargs] for func_name, args, kwargs in calls]
+    if _batch_calls is not None:
+        _batch_calls.extend(calls)
+        return None
+    if not calls:
+        return []
+    send_msg(sock, pack_data(['_batch', calls, {}], True))
+    results = unpack_results(recv_msg(sock))
+    for result in results:
+        _check_error(result)
+    return results
+def SetParmVals(parm_ids, vals):"""+SET_PARM_VALS_DOC+r"""
+    result = _send_recieve('SetParmValVec', (list(parm_ids), list(vals)), {})
+    return result if result is None else list(result)
+def GetParmVals(parm_ids):"""+GET_PARM_VALS_DOC+r"""
+    result = _send_recieve('GetParmValVec', (list(parm_ids),), {})
+    return result if result is None else list(result)
+class Batch:"""+BATCH_DOC+r"""
+    def __enter__(self):
+        global _batch_calls
+        if _batch_calls is not None:
+            raise RuntimeError("Batch blocks can not be nested")
+        _batch_calls = []
+        self.results = None
+        return self
+    def __exit__(self, exc_type, exc_value, tb):
+        global _batch_calls
+        calls = _batch_calls
+        _batch_calls = None
+        if exc_type is None:
+            self.results = CallBatch(calls)
+        return False
 """
 
 DECORATOR_CODE = """
@@ -184,8 +286,13 @@ def make_server():
     server_string = r"""
 from threading import Thread, Event
 import pickle
+import struct
 import traceback
 import sys
+try:
+    from multiprocessing import shared_memory, resource_tracker
+except ImportError:
+    shared_memory = None
 
 #special code that is not generalizable
 import openvsp_config
@@ -205,77 +312,154 @@ global gui_active
 gui_active = False
 debug = False
 
-def pack_data(data, is_command_list=False):
-    def sub_pack(sub_data):
-        new_data = sub_data
-        if isinstance(sub_data, module.vec3d):
-            new_data = {"name":'vec3d',
-                "x":sub_data.x(),
-                "y":sub_data.y(),
-                "z":sub_data.z(),
-            }
-        elif isinstance(sub_data, list) or isinstance(sub_data, tuple):
-            if len(sub_data) > 0:
-                if isinstance(sub_data[0], module.vec3d):
-                    new_data = {
-                        "name": "vec3d_list",
-                        "list": []
-                    }
-                    for p in sub_data:
-                        thing = {
-                            "x":p.x(),
-                            "y":p.y(),
-                            "z":p.z(),
-                        }
-                        new_data['list'].append(thing)
-                elif sub_data[0] == "error":
-                    pass
-
-        return new_data
+# Every message is a header (kind, payload size) followed by the payload.  Payloads
+# larger than SHM_THRESHOLD are passed in a shared memory block whose name follows
+# the header instead.  The reader unlinks the block once it has copied it out.
+HEADER = struct.Struct('<BQ')
+MSG_INLINE = 0
+MSG_SHM = 1
+SHM_THRESHOLD = 1 << 20
+
+def _recv_exact(conn, n):
+    buf = bytearray(n)
+    view = memoryview(buf)
+    pos = 0
+    while pos < n:
+        nrecv = conn.recv_into(view[pos:], n - pos)
+        if nrecv == 0:
+            raise EOFError("Socket closed")
+        pos += nrecv
+    return buf
+
+def send_msg(conn, b_data, allow_shm=False):
+    if allow_shm and shared_memory is not None and len(b_data) > SHM_THRESHOLD:
+        shm = shared_memory.SharedMemory(create=True, size=len(b_data))
+        shm.buf[:len(b_data)] = b_data
+        name = shm.name.encode()
+        try:
+            # Ownership passes to the reader
+            resource_tracker.unregister(shm._name, 'shared_memory')
+        except Exception:
+            pass
+        shm.close()
+        conn.sendall(HEADER.pack(MSG_SHM, len(b_data)) + struct.pack('<H', len(name)) + name)
+    else:
+        conn.sendall(HEADER.pack(MSG_INLINE, len(b_data)) + b_data)
+
+def recv_msg(conn):
+    kind, size = HEADER.unpack(_recv_exact(conn, HEADER.size))
+    if kind == MSG_SHM:
+        name_len, = struct.unpack('<H', _recv_exact(conn, 2))
+        name = bytes(_recv_exact(conn, name_len)).decode()
+        shm = shared_memory.SharedMemory(name=name)
+        b_data = bytes(shm.buf[:size])
+        shm.close()
+        shm.unlink()
+        return b_data
+    return bytes(_recv_exact(conn, size))
+
+def _pack_value(sub_data):
+    new_data = sub_data
+    if isinstance(sub_data, module.vec3d):
+        new_data = {"name":'vec3d',
+            "x":sub_data.x(),
+            "y":sub_data.y(),
+            "z":sub_data.z(),
+        }
+    elif isinstance(sub_data, list) or isinstance(sub_data, tuple):
+        if len(sub_data) > 0:
+            if isinstance(sub_data[0], module.vec3d):
+                # flat coordinate list pickles far smaller and faster than one dict per point
+                xyz = []
+                for p in sub_data:
+                    xyz.extend((p.x(), p.y(), p.z()))
+                new_data = {
+                    "name": "vec3d_list",
+                    "xyz": xyz
+                }
+            elif sub_data[0] == "error":
+                pass
 
-    if is_command_list:
+    return new_data
 
-        #commands look like this: [func_name (str), args (list [arg1, arg2, argn]), kwargs (dict keyword1: arg1, kw2: arg2)  ]
-        # example
-        #                               [comp_name,     args,       dict]
-        # vsp.compvecpnt01(uv_array) -> ["compvepnt01", [uv_array], {}  ]
-        #
-        new_data = [data[0], [], {}]
-        for value in data[1]:
-            new_data[1].append(sub_pack(value))
-        for key, value in data[2].items():
-            new_data[2][key] = sub_pack(value)
-        new_data[1] = tuple(new_data[1])
+def _unpack_value(sub_data):
+    n_data = sub_data
+    if isinstance(sub_data, dict):
+        if sub_data['name'] == 'vec3d':
+            n_data = module.vec3d(sub_data['x'], sub_data['y'], sub_data['z'])
+        elif sub_data['name'] == 'vec3d_list':
+            xyz = sub_data['xyz']
+            n_data = [module.vec3d(xyz[i], xyz[i + 1], xyz[i + 2]) for i in range(0, len(xyz), 3)]
+    return n_data
+
+#commands look like this: [func_name (str), args (list [arg1, arg2, argn]), kwargs (dict keyword1: arg1, kw2: arg2)  ]
+# example
+#                               [comp_name,     args,       dict]
+# vsp.compvecpnt01(uv_array) -> ["compvepnt01", [uv_array], {}  ]
+#
+# A batch is ['_batch', [command, command, ...], {}]
+#
+def _pack_command(data):
+    return [data[0], tuple(_pack_value(value) for value in data[1]),
+            {key: _pack_value(value) for key, value in data[2].items()}]
+
+def _unpack_command(data):
+    return [data[0], tuple(_unpack_value(value) for value in data[1]),
+            {key: _unpack_value(value) for key, value in data[2].items()}]
+
+def pack_data(data, is_command_list=False):
+    if is_command_list:
+        if data[0] == '_batch':
+            new_data = [data[0], [_pack_command(command) for command in data[1]], {}]
+        else:
+            new_data = _pack_command(data)
     else:
-       new_data = sub_pack(data)
-    b_data = pickle.dumps(new_data)
-    return b_data
+       new_data = _pack_value(data)
+    return pickle.dumps(new_data, pickle.HIGHEST_PROTOCOL)
 
 def unpack_data(b_data, is_command_list=False):
-    def sub_unpack(sub_data):
-        n_data = sub_data
-        if isinstance(sub_data, dict):
-            if sub_data['name'] == 'vec3d':
-                n_data = module.vec3d(sub_data['x'], sub_data['y'], sub_data['z'])
-            elif sub_data['name'] == 'vec3d_list':
-                n_data = []
-                for r in sub_data['list']:
-                    n_data.append(module.vec3d(r['x'], r['y'], r['z']))
-        return n_data
-
-    data = pickle.loads(b"".join(b_data))
+    data = pickle.loads(b_data)
     if is_command_list:
-        new_data = [data[0], [], {}]
-        for value in data[1]:
-            new_data[1].append(sub_unpack(value))
-        for key, value in data[2].items():
-            new_data[2][key] = sub_unpack(value)
-        new_data[1] = tuple(new_data[1])
+        if data[0] == '_batch':
+            new_data = [data[0], [_unpack_command(command) for command in data[1]], {}]
+        else:
+            new_data = _unpack_command(data)
     else:
-       new_data = sub_unpack(data)
-
+       new_data = _unpack_value(data)
     return new_data
 
+def pack_results(results):
+    return pickle.dumps([_pack_value(result) for result in results], pickle.HIGHEST_PROTOCOL)
+
+def unpack_results(b_data):
+    return [_unpack_value(result) for result in pickle.loads(b_data)]
+
+def _call_commands(commands):
+    results = []
+    if debug:
+        print("Server Socket Thread: A1 Waiting for Lock")
+    if gui_active:
+        module.Lock()
+        if debug:
+            print("Server Socket Thread: A2 Lock obtained")
+    try:
+        for func_name, args, kwargs in commands:
+            try:
+                foo = getattr(module, func_name)
+                results.append(foo(*args, **kwargs))
+            except Exception as e:
+                exc_info = sys.exc_info()
+                results.append(["error", ''.join(traceback.format_exception(*exc_info))])
+                break
+        if debug:
+            print("Server Socket Thread: A3 VSP function called")
+    finally:
+        if gui_active:
+            module.Unlock()
+            if debug:
+                print("Server Socket Thread: A4 Lock released")
+    return results
+
 def start_server():
     import socket
     global gui_active
@@ -287,25 +471,17 @@ def start_server():
             s.listen()
             conn, addr = s.accept()
             with conn:
+                conn.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
                 print("Server Socket Thread: Connected by %s, %s"%(addr[0], addr[1]))
                 while True:
-                    b_data = []
                     # Wait for command
-                    while True:
-                        try:
-                            packet = conn.recv(1024)
-                        except ConnectionResetError:
-                            print("Socket ConnectionResetError")
-                            socket_open = False
-                            break
-                        if not packet: break
-                        b_data.append(packet)
-                        try:
-                            data = unpack_data(b_data, is_command_list=True)
-                            break
-                        except (pickle.UnpicklingError, EOFError):
-                            pass
-                    if b_data == []:
+                    try:
+                        data = unpack_data(recv_msg(conn), is_command_list=True)
+                    except ConnectionResetError:
+                        print("Socket ConnectionResetError")
+                        socket_open = False
+                        break
+                    except EOFError:
                         break
 
                     # Special functionality for StartGUI
@@ -341,36 +517,20 @@ def start_server():
                         result = 0
                         b_result = pack_data(result)
 
+                    # Batch of calls made under one lock, one message back
+                    elif data[0] == '_batch':
+                        b_result = pack_results(_call_commands(data[1]))
+
                     # Regular functionality
                     else:
-                        func_name = data[0]
-                        args = data[1]
-                        kwargs = data[2]
-                        foo = getattr(module, func_name)
-                        try:
-                            if debug:
-                                print("Server Socket Thread: A1 Waiting for Lock")
-                            if gui_active:
-                                module.Lock()
-                                if debug:
-                                    print("Server Socket Thread: A2 Lock obtained")
-                            result = foo(*args, **kwargs)
-                            if debug:
-                                print("Server Socket Thread: A3 VSP function called")
-                            if gui_active:
-                                module.Unlock()
-                                if debug:
-                                    print("Server Socket Thread: A4 Lock released")
-                        except Exception as e:
-                            exc_info = sys.exc_info()
-                            result = ["error", ''.join(traceback.format_exception(*exc_info))]
+                        result = _call_commands([data])[0]
                         b_result = pack_data(result)
 
                     # Try to send response back
                     try:
                         if debug:
                             print("Server Socket Thread: sending data back")
-                        conn.sendall(b_result)
+                        send_msg(conn, b_result, allow_shm=True)
                     except ConnectionResetError:
                         print("Server Socket Thread: Unable to send data to socket, closing server.")
                         socket_open = False
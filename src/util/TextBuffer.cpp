@@ -0,0 +1,51 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// TextBuffer.cpp: implementation of the TextBuffer class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "TextBuffer.h"
+
+#include <cstdarg>
+
+void TextBuffer::Printf( const char* fmt, ... )
+{
+    // Format straight into the tail of the buffer, growing once if the guess is short
+    size_t old_size = m_Buf.size();
+    size_t avail = 256;
+    m_Buf.resize( old_size + avail );
+
+    va_list args;
+    va_start( args, fmt );
+    int n = vsnprintf( &m_Buf[ old_size ], avail, fmt, args );
+    va_end( args );
+
+    if ( n < 0 )
+    {
+        m_Buf.resize( old_size );
+        return;
+    }
+
+    if ( ( size_t )n >= avail )
+    {
+        m_Buf.resize( old_size + n + 1 );
+
+        va_start( args, fmt );
+        vsnprintf( &m_Buf[ old_size ], n + 1, fmt, args );
+        va_end( args );
+    }
+
+    m_Buf.resize( old_size + n );
+}
+
+bool TextBuffer::Write( FILE* file_id ) const
+{
+    if ( !file_id )
+    {
+        return false;
+    }
+    return fwrite( m_Buf.data(), 1, m_Buf.size(), file_id ) == m_Buf.size();
+}
@@ -0,0 +1,49 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// TextBuffer.h: In-memory text output for large file writers
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(TEXTBUFFER__INCLUDED_)
+#define TEXTBUFFER__INCLUDED_
+
+#include <cstdio>
+#include <string>
+
+using std::string;
+
+//==== Text Buffer ====//
+// Collects formatted text in memory so a writer can be run without touching
+// the FILE ( and its lock ) per value, on any thread, and the result written
+// out with one fwrite.
+class TextBuffer
+{
+public:
+    TextBuffer()                                    {}
+
+    void Printf( const char* fmt, ... )
+#if defined( __GNUC__ )
+        __attribute__( ( format( printf, 2, 3 ) ) )
+#endif
+        ;
+
+    void Append( const string & str )               { m_Buf.append( str ); }
+    void Append( const char* str )                  { m_Buf.append( str ); }
+
+    void Reserve( size_t n )                        { m_Buf.reserve( n ); }
+    void Clear()                                    { m_Buf.clear(); }
+    size_t Size() const                             { return m_Buf.size(); }
+    const string & GetString() const                { return m_Buf; }
+
+    // Returns false if the write was short
+    bool Write( FILE* file_id ) const;
+
+protected:
+
+    string m_Buf;
+};
+
+#endif // !defined(TEXTBUFFER__INCLUDED_)
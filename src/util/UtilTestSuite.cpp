@@ -8,6 +8,8 @@
 #include "UtilTestSuite.h"
 
 #include <float.h>
+#include <algorithm>
+#include <chrono>
 #include "StringUtil.h"
 #include "StlHelper.h"
 #include "VspUtil.h"
@@ -478,6 +480,169 @@ void UtilTestSuite::VspSurfTest()
 }
 
 
+//==== Test VspSurf Batched Evaluation Against Point-By-Point Code-Eli ====//
+void UtilTestSuite::VspSurfBatchEvalTest()
+{
+    vector< VspCurve > crv_vec;
+    for ( int k = 0; k < 6; k++ )
+    {
+        vector< vec3d > pnt_vec;
+        vector< double > param;
+        double r = 1.0 + 0.3 * k - 0.05 * k * k;
+        for ( int i = 0; i < 8; i++ )
+        {
+            double theta = 2.0 * M_PI * i / 8.0;
+            pnt_vec.push_back( vec3d( 1.3 * k, r * cos( theta ) * ( 1.0 + 0.2 * ( i % 3 ) ), r * sin( theta ) ) );
+            param.push_back( i );
+        }
+        param.push_back( 8 );
+
+        VspCurve crv;
+        crv.InterpolateCSpline( pnt_vec, param, true );
+        crv_vec.push_back( crv );
+    }
+
+    VspSurf srf;
+    srf.SkinC2( crv_vec, false );
+
+    int nu = 201;
+    int nw = 201;
+    vector< double > u( nu ), w( nw );
+    for ( int i = 0; i < nu; i++ )
+    {
+        u[i] = srf.GetUMax() * i / ( nu - 1.0 );
+    }
+    for ( int j = 0; j < nw; j++ )
+    {
+        w[j] = srf.GetWMax() * j / ( nw - 1.0 );
+    }
+
+    //==== Batched Grid ====//
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+
+    vector< vector< vec3d > > pnts, tanu, tanw, norms;
+    srf.CompGrid( u, w, pnts, tanu, tanw, norms );
+
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    //==== Point-By-Point ====//
+    double dmax = 0.0;
+    for ( int i = 0; i < nu; i++ )
+    {
+        for ( int j = 0; j < nw; j++ )
+        {
+            dmax = max( dmax, dist( pnts[i][j], srf.CompPnt( u[i], w[j] ) ) );
+            dmax = max( dmax, dist( norms[i][j], srf.CompNorm( u[i], w[j] ) ) );
+            dmax = max( dmax, dist( tanu[i][j], srf.CompTanU( u[i], w[j] ) ) );
+            dmax = max( dmax, dist( tanw[i][j], srf.CompTanW( u[i], w[j] ) ) );
+        }
+    }
+
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+
+    TEST_ASSERT_DELTA( dmax, 0.0, 1e-12 );
+
+    //==== Scattered Points ====//
+    vector< double > us, ws;
+    for ( int k = 0; k < 1000; k++ )
+    {
+        us.push_back( srf.GetUMax() * ( ( k * 37 ) % 1000 ) / 999.0 );
+        ws.push_back( srf.GetWMax() * ( ( k * 91 ) % 1000 ) / 999.0 );
+    }
+
+    vector< vec3d > pvec, nvec;
+    srf.CompPntVec( us, ws, pvec );
+    srf.CompNormVec( us, ws, nvec );
+
+    dmax = 0.0;
+    for ( int k = 0; k < ( int )us.size(); k++ )
+    {
+        dmax = max( dmax, dist( pvec[k], srf.CompPnt( us[k], ws[k] ) ) );
+        dmax = max( dmax, dist( nvec[k], srf.CompNorm( us[k], ws[k] ) ) );
+    }
+    TEST_ASSERT_DELTA( dmax, 0.0, 1e-12 );
+
+    printf( "\tBatched grid: %f ms  Point-by-point: %f ms\n",
+            std::chrono::duration < double, std::milli > ( t1 - t0 ).count(),
+            std::chrono::duration < double, std::milli > ( t2 - t1 ).count() );
+}
+
+void UtilTestSuite::VspSurfRefineTessTest()
+{
+    vector< VspCurve > crv_vec;
+    for ( int k = 0; k < 6; k++ )
+    {
+        vector< vec3d > pnt_vec;
+        vector< double > param;
+        double r = 1.0 + 0.3 * k - 0.05 * k * k;
+        for ( int i = 0; i < 8; i++ )
+        {
+            double theta = 2.0 * M_PI * i / 8.0;
+            pnt_vec.push_back( vec3d( 1.3 * k, r * cos( theta ), r * sin( theta ) ) );
+            param.push_back( i );
+        }
+        param.push_back( 8 );
+
+        VspCurve crv;
+        crv.InterpolateCSpline( pnt_vec, param, true );
+        crv_vec.push_back( crv );
+    }
+
+    VspSurf srf;
+    srf.SkinC2( crv_vec, false );
+
+    vector< double > u0, w0;
+    for ( int i = 0; i < 6; i++ )
+    {
+        u0.push_back( srf.GetUMax() * i / 5.0 );
+    }
+    for ( int j = 0; j < 9; j++ )
+    {
+        w0.push_back( srf.GetWMax() * j / 8.0 );
+    }
+
+    //==== Refinement Off Leaves The Grid Alone ====//
+    vector< double > u = u0, w = w0;
+    srf.RefineTess( u, w );
+    TEST_ASSERT( u == u0 );
+    TEST_ASSERT( w == w0 );
+
+    //==== Chord Deviation At Cell Centers ====//
+    auto max_chord = [ & ]( const vector< double > & uu, const vector< double > & ww )
+    {
+        double dmax = 0.0;
+        for ( int i = 0; i < ( int )uu.size() - 1; i++ )
+        {
+            for ( int j = 0; j < ( int )ww.size() - 1; j++ )
+            {
+                vec3d lin = ( srf.CompPnt( uu[i], ww[j] ) + srf.CompPnt( uu[i + 1], ww[j] ) +
+                              srf.CompPnt( uu[i], ww[j + 1] ) + srf.CompPnt( uu[i + 1], ww[j + 1] ) ) * 0.25;
+                vec3d mid = srf.CompPnt( 0.5 * ( uu[i] + uu[i + 1] ), 0.5 * ( ww[j] + ww[j + 1] ) );
+                dmax = max( dmax, dist( lin, mid ) );
+            }
+        }
+        return dmax;
+    };
+
+    srf.SetTessAdapt( 1e-3, 10.0, 4 );
+    srf.RefineTess( u, w );
+
+    TEST_ASSERT( u.size() * w.size() > u0.size() * w0.size() );
+    TEST_ASSERT( max_chord( u, w ) < max_chord( u0, w0 ) );
+
+    // Original stations are kept and the result stays sorted
+    for ( int i = 0; i < ( int )u0.size(); i++ )
+    {
+        TEST_ASSERT( std::find( u.begin(), u.end(), u0[i] ) != u.end() );
+    }
+    for ( int j = 0; j < ( int )w0.size(); j++ )
+    {
+        TEST_ASSERT( std::find( w.begin(), w.end(), w0[j] ) != w.end() );
+    }
+    TEST_ASSERT( std::is_sorted( u.begin(), u.end() ) );
+    TEST_ASSERT( std::is_sorted( w.begin(), w.end() ) );
+}
+
 //==== WriteSurface =====//
 #if 0
 void UtilTestSuite::WriteSurf( vector< vector< PntNorm > > & pnt_norm_vec, string file_name )
@@ -33,6 +33,8 @@ public:
         TEST_ADD( UtilTestSuite::StlHelperTest )
         TEST_ADD( UtilTestSuite::VspCurveTest )
         TEST_ADD( UtilTestSuite::VspSurfTest )
+        TEST_ADD( UtilTestSuite::VspSurfBatchEvalTest )
+        TEST_ADD( UtilTestSuite::VspSurfRefineTessTest )
         TEST_ADD( UtilTestSuite::SharedPtrTest )
         TEST_ADD( UtilTestSuite::PointInPolyTest )
         TEST_ADD( UtilTestSuite::BilinearInterpTest )
@@ -47,6 +49,8 @@ private:
     void StlHelperTest();
     void VspCurveTest();
     void VspSurfTest();
+    void VspSurfBatchEvalTest();
+    void VspSurfRefineTessTest();
     void SharedPtrTest();
     void PointInPolyTest();
     void BilinearInterpTest();
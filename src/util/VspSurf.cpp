@@ -67,6 +67,7 @@ VspSurf::VspSurf()
     m_CloneIndex = -1;
 
     SetClustering( 1.0, 1.0 );
+    SetTessAdapt( 0.0, 0.0, 0 );
 
     m_FoilSurf = NULL;
     m_LECluster = 1.0;
@@ -91,6 +92,13 @@ void VspSurf::SetClustering( const double &le, const double &te )
     m_TECluster = te;
 }
 
+void VspSurf::SetTessAdapt( const double &chord_tol, const double &angle_tol, const int &max_level )
+{
+    m_TessChordTol = chord_tol;
+    m_TessAngleTol = angle_tol;
+    m_TessAdaptLevel = max_level;
+}
+
 void VspSurf::SetRootTipClustering( const vector < double > &root, const vector < double > &tip ) const
 {
     m_RootCluster = root;
@@ -1218,6 +1226,456 @@ void VspSurf::CompCurvature01( double u01, double v01, double& k1, double& k2, d
     CompCurvature( u01 * GetUMax(), v01 * GetWMax(), k1, k2, ka, kg );
 }
 
+//==== Batched Evaluation Support ====//
+// Bernstein basis of degree n and its first derivative at t.
+static void BernsteinBasis( int n, double t, double *b, double *db )
+{
+    double s = 1.0 - t;
+
+    b[0] = 1.0;
+    db[0] = 0.0;
+
+    for ( int k = 1; k <= n; k++ )
+    {
+        if ( k == n ) // Derivative comes from the degree n-1 basis.
+        {
+            db[0] = -n * b[0];
+            for ( int i = 1; i < n; i++ )
+            {
+                db[i] = n * ( b[i - 1] - b[i] );
+            }
+            db[n] = n * b[n - 1];
+        }
+
+        double saved = 0.0;
+        for ( int i = 0; i < k; i++ )
+        {
+            double tmp = b[i];
+            b[i] = saved + s * tmp;
+            saved = t * tmp;
+        }
+        b[k] = saved;
+    }
+}
+
+// Patch index, local parameter and tabulated basis for a vector of parameters.
+// Each parameter is located and its basis built once, so every row (or column)
+// of a grid that shares it reuses the table.
+class SurfBasisTable
+{
+public:
+
+    void Build( const vector < double > &t, const vector < double > &pmap, const vector < int > &deg, bool grid )
+    {
+        int n = t.size();
+        int npatch = pmap.size() - 1;
+
+        m_Patch.resize( n );
+        m_Local.resize( n );
+        m_Scale.resize( n );
+        m_Degree.resize( n );
+        m_Offset.resize( n );
+
+        int ntot = 0;
+        for ( int i = 0; i < n; i++ )
+        {
+            int k = std::upper_bound( pmap.begin(), pmap.end() - 1, t[i] ) - pmap.begin() - 1;
+            k = clamp( k, 0, npatch - 1 );
+
+            double dp = pmap[k + 1] - pmap[k];
+            double tt = clamp( ( t[i] - pmap[k] ) / dp, 0.0, 1.0 );
+
+            // Match Code-Eli grid evaluation, last grid point on a patch boundary
+            // belongs to the preceding patch.
+            if ( grid && i == n - 1 && n > 1 && k > 0 && t[i] == pmap[k] )
+            {
+                k--;
+                dp = pmap[k + 1] - pmap[k];
+                tt = 1.0;
+            }
+
+            m_Patch[i] = k;
+            m_Local[i] = tt;
+            m_Scale[i] = 1.0 / dp;
+            m_Degree[i] = deg[k];
+            m_Offset[i] = ntot;
+            ntot += deg[k] + 1;
+        }
+
+        m_B.resize( ntot );
+        m_dB.resize( ntot );
+        for ( int i = 0; i < n; i++ )
+        {
+            BernsteinBasis( m_Degree[i], m_Local[i], &m_B[ m_Offset[i] ], &m_dB[ m_Offset[i] ] );
+        }
+    }
+
+    vector < int > m_Patch;
+    vector < double > m_Local;
+    vector < double > m_Scale;
+    vector < int > m_Degree;
+    vector < int > m_Offset;
+    vector < double > m_B;
+    vector < double > m_dB;
+};
+
+// Control points of each patch unpacked into contiguous xyz triples, filled the
+// first time a patch is touched.
+class SurfPatchTable
+{
+public:
+
+    SurfPatchTable( const piecewise_surface_type &s ) : m_Surf( s )
+    {
+        m_NU = s.number_u_patches();
+        m_NV = s.number_v_patches();
+        m_CP.resize( m_NU * m_NV );
+        m_DegU.resize( m_NU * m_NV, -1 );
+        m_DegV.resize( m_NU * m_NV, -1 );
+    }
+
+    const double * GetCP( int uk, int vk, int &n, int &m )
+    {
+        int ip = uk * m_NV + vk;
+        if ( m_DegU[ip] < 0 )
+        {
+            const surface_patch_type *patch = m_Surf.get_patch( uk, vk );
+            int nn = patch->degree_u();
+            int mm = patch->degree_v();
+
+            vector < double > &cp = m_CP[ip];
+            cp.resize( 3 * ( nn + 1 ) * ( mm + 1 ) );
+            for ( int i = 0; i <= nn; i++ )
+            {
+                for ( int j = 0; j <= mm; j++ )
+                {
+                    surface_point_type p = patch->get_control_point( i, j );
+                    double *c = &cp[ 3 * ( i * ( mm + 1 ) + j ) ];
+                    c[0] = p.x();
+                    c[1] = p.y();
+                    c[2] = p.z();
+                }
+            }
+            m_DegU[ip] = nn;
+            m_DegV[ip] = mm;
+        }
+        n = m_DegU[ip];
+        m = m_DegV[ip];
+        return &m_CP[ip][0];
+    }
+
+protected:
+
+    const piecewise_surface_type &m_Surf;
+    int m_NU;
+    int m_NV;
+    vector < vector < double > > m_CP;
+    vector < int > m_DegU;
+    vector < int > m_DegV;
+};
+
+// Contract the u basis against a patch's control net, leaving one xyz point
+// (and u derivative) per control row in v.  Inner loops run over contiguous
+// doubles so the compiler can vectorize them.
+static void ContractU( const double *cp, int n, int m, const double *bu, const double *dbu, double *q, double *dq )
+{
+    int nq = 3 * ( m + 1 );
+    std::fill( q, q + nq, 0.0 );
+    std::fill( dq, dq + nq, 0.0 );
+
+    for ( int i = 0; i <= n; i++ )
+    {
+        const double *row = cp + i * nq;
+        double b = bu[i];
+        double db = dbu[i];
+        for ( int l = 0; l < nq; l++ )
+        {
+            q[l] += b * row[l];
+            dq[l] += db * row[l];
+        }
+    }
+}
+
+// Finish a point from the contracted rows.
+static void ContractV( const double *q, const double *dq, int m, const double *bv, const double *dbv,
+                       double *p, double *pu, double *pv )
+{
+    p[0] = p[1] = p[2] = 0.0;
+    pu[0] = pu[1] = pu[2] = 0.0;
+    pv[0] = pv[1] = pv[2] = 0.0;
+
+    for ( int j = 0; j <= m; j++ )
+    {
+        const double *qj = q + 3 * j;
+        const double *dqj = dq + 3 * j;
+        for ( int l = 0; l < 3; l++ )
+        {
+            p[l] += bv[j] * qj[l];
+            pu[l] += bv[j] * dqj[l];
+            pv[l] += dbv[j] * qj[l];
+        }
+    }
+}
+
+static void PatchDegrees( const piecewise_surface_type &s, vector < int > &degu, vector < int > &degv )
+{
+    int nu = s.number_u_patches();
+    int nv = s.number_v_patches();
+
+    degu.resize( nu );
+    for ( int i = 0; i < nu; i++ )
+    {
+        degu[i] = s.get_patch( i, 0 )->degree_u();
+    }
+
+    degv.resize( nv );
+    for ( int j = 0; j < nv; j++ )
+    {
+        degv[j] = s.get_patch( 0, j )->degree_v();
+    }
+}
+
+// Basis for one parameter, recomputed only when a patch's degree differs from the
+// degree the table was built with.
+static const double * PatchBasis( const SurfBasisTable &tab, int i, int deg, vector < double > &b, vector < double > &db, const double * &dbout )
+{
+    if ( deg == tab.m_Degree[i] )
+    {
+        dbout = &tab.m_dB[ tab.m_Offset[i] ];
+        return &tab.m_B[ tab.m_Offset[i] ];
+    }
+
+    b.resize( deg + 1 );
+    db.resize( deg + 1 );
+    BernsteinBasis( deg, tab.m_Local[i], &b[0], &db[0] );
+    dbout = &db[0];
+    return &b[0];
+}
+
+//===== Evaluate Grid Of Points, Tangents And Normals =====//
+// Low level batched evaluator.  Normals are not flipped.  Any output pointer may
+// be NULL.
+void VspSurf::EvalGrid( const vector < double > &u, const vector < double > &w, vector< vector< vec3d > > *pnts,
+                        vector< vector< vec3d > > *tanu, vector< vector< vec3d > > *tanw, vector< vector< vec3d > > *norms ) const
+{
+    int nu = u.size();
+    int nw = w.size();
+
+    if ( pnts ) pnts->resize( nu );
+    if ( tanu ) tanu->resize( nu );
+    if ( tanw ) tanw->resize( nu );
+    if ( norms ) norms->resize( nu );
+
+    if ( m_Surface.number_u_patches() == 0 || m_Surface.number_v_patches() == 0 || nu == 0 || nw == 0 )
+    {
+        return;
+    }
+
+    vector < double > upmap, wpmap;
+    m_Surface.get_pmap_uv( upmap, wpmap );
+
+    vector < int > degu, degw;
+    PatchDegrees( m_Surface, degu, degw );
+
+    SurfBasisTable utab, wtab;
+    utab.Build( u, upmap, degu, true );
+    wtab.Build( w, wpmap, degw, true );
+
+    SurfPatchTable ptab( m_Surface );
+
+    surface_tolerance_type tol;
+
+    vector < double > q, dq, bu, dbu, bw, dbw;
+
+    for ( int i = 0; i < nu; i++ )
+    {
+        if ( pnts ) ( *pnts )[i].resize( nw );
+        if ( tanu ) ( *tanu )[i].resize( nw );
+        if ( tanw ) ( *tanw )[i].resize( nw );
+        if ( norms ) ( *norms )[i].resize( nw );
+
+        int uk = utab.m_Patch[i];
+        int lastwk = -1;
+        int n = 0, m = 0;
+
+        for ( int j = 0; j < nw; j++ )
+        {
+            int wk = wtab.m_Patch[j];
+
+            if ( wk != lastwk )
+            {
+                const double *cp = ptab.GetCP( uk, wk, n, m );
+
+                const double *dbup;
+                const double *bup = PatchBasis( utab, i, n, bu, dbu, dbup );
+
+                q.resize( 3 * ( m + 1 ) );
+                dq.resize( 3 * ( m + 1 ) );
+                ContractU( cp, n, m, bup, dbup, &q[0], &dq[0] );
+                lastwk = wk;
+            }
+
+            const double *dbwp;
+            const double *bwp = PatchBasis( wtab, j, m, bw, dbw, dbwp );
+
+            double p[3], pu[3], pw[3];
+            ContractV( &q[0], &dq[0], m, bwp, dbwp, p, pu, pw );
+
+            vec3d su( pu[0], pu[1], pu[2] );
+            vec3d sw( pw[0], pw[1], pw[2] );
+            su = su * utab.m_Scale[i];
+            sw = sw * wtab.m_Scale[j];
+
+            if ( pnts ) ( *pnts )[i][j].set_xyz( p[0], p[1], p[2] );
+            if ( tanu ) ( *tanu )[i][j] = su;
+            if ( tanw ) ( *tanw )[i][j] = sw;
+
+            if ( norms )
+            {
+                vec3d nrm = cross( su, sw );
+                double len = nrm.mag();
+
+                if ( tol.approximately_equal( len, 0 ) )
+                {
+                    // Let Code-Eli sort out degenerate points.
+                    surface_point_type np( m_Surface.normal( u[i], w[j] ) );
+                    nrm.set_xyz( np.x(), np.y(), np.z() );
+                }
+                else
+                {
+                    nrm = nrm / len;
+                }
+                ( *norms )[i][j] = nrm;
+            }
+        }
+    }
+}
+
+//===== Evaluate Points And Normals At Scattered (U,W) Pairs =====//
+// Low level batched evaluator.  Normals are not flipped.  Either output pointer
+// may be NULL.
+void VspSurf::EvalVec( const vector < double > &u, const vector < double > &w, vector < vec3d > *pnts, vector < vec3d > *norms ) const
+{
+    int npt = std::min( u.size(), w.size() );
+
+    if ( pnts ) pnts->resize( npt );
+    if ( norms ) norms->resize( npt );
+
+    if ( m_Surface.number_u_patches() == 0 || m_Surface.number_v_patches() == 0 || npt == 0 )
+    {
+        return;
+    }
+
+    vector < double > upmap, wpmap;
+    m_Surface.get_pmap_uv( upmap, wpmap );
+
+    vector < int > degu, degw;
+    PatchDegrees( m_Surface, degu, degw );
+
+    SurfBasisTable utab, wtab;
+    utab.Build( u, upmap, degu, false );
+    wtab.Build( w, wpmap, degw, false );
+
+    SurfPatchTable ptab( m_Surface );
+
+    surface_tolerance_type tol;
+
+    vector < double > q, dq, bu, dbu, bw, dbw;
+
+    for ( int k = 0; k < npt; k++ )
+    {
+        int n, m;
+        const double *cp = ptab.GetCP( utab.m_Patch[k], wtab.m_Patch[k], n, m );
+
+        const double *dbup;
+        const double *bup = PatchBasis( utab, k, n, bu, dbu, dbup );
+        const double *dbwp;
+        const double *bwp = PatchBasis( wtab, k, m, bw, dbw, dbwp );
+
+        q.resize( 3 * ( m + 1 ) );
+        dq.resize( 3 * ( m + 1 ) );
+        ContractU( cp, n, m, bup, dbup, &q[0], &dq[0] );
+
+        double p[3], pu[3], pw[3];
+        ContractV( &q[0], &dq[0], m, bwp, dbwp, p, pu, pw );
+
+        if ( pnts ) ( *pnts )[k].set_xyz( p[0], p[1], p[2] );
+
+        if ( norms )
+        {
+            vec3d su( pu[0], pu[1], pu[2] );
+            vec3d sw( pw[0], pw[1], pw[2] );
+            vec3d nrm = cross( su, sw );
+            double len = nrm.mag();
+
+            if ( tol.approximately_equal( len, 0 ) )
+            {
+                surface_point_type np( m_Surface.normal( u[k], w[k] ) );
+                nrm.set_xyz( np.x(), np.y(), np.z() );
+            }
+            else
+            {
+                nrm = nrm / len;
+            }
+            ( *norms )[k] = nrm;
+        }
+    }
+}
+
+//===== Compute Grid Of Points And Normals Given U W Vectors =====//
+void VspSurf::CompPntNormGrid( const vector < double > &u, const vector < double > &w, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &norms ) const
+{
+    EvalGrid( u, w, &pnts, NULL, NULL, &norms );
+
+    if ( m_FlipNormal )
+    {
+        for ( int i = 0; i < norms.size(); i++ )
+        {
+            for ( int j = 0; j < norms[i].size(); j++ )
+            {
+                norms[i][j] = -1.0 * norms[i][j];
+            }
+        }
+    }
+}
+
+//===== Compute Grid Of Points, Tangents And Normals Given U W Vectors =====//
+void VspSurf::CompGrid( const vector < double > &u, const vector < double > &w, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &tanu, vector< vector< vec3d > > &tanw, vector< vector< vec3d > > &norms ) const
+{
+    EvalGrid( u, w, &pnts, &tanu, &tanw, &norms );
+
+    if ( m_FlipNormal )
+    {
+        for ( int i = 0; i < norms.size(); i++ )
+        {
+            for ( int j = 0; j < norms[i].size(); j++ )
+            {
+                norms[i][j] = -1.0 * norms[i][j];
+            }
+        }
+    }
+}
+
+//===== Compute Points At (U,W) Pairs =====//
+void VspSurf::CompPntVec( const vector < double > &u, const vector < double > &w, vector < vec3d > &pnts ) const
+{
+    EvalVec( u, w, &pnts, NULL );
+}
+
+//===== Compute Normals At (U,W) Pairs =====//
+void VspSurf::CompNormVec( const vector < double > &u, const vector < double > &w, vector < vec3d > &norms ) const
+{
+    EvalVec( u, w, NULL, &norms );
+
+    if ( m_FlipNormal )
+    {
+        for ( int k = 0; k < norms.size(); k++ )
+        {
+            norms[k] = -1.0 * norms[k];
+        }
+    }
+}
+
 void VspSurf::ResetUSkip() const
 {
     piecewise_surface_type::index_type ip, nupatch, nwpatch;
@@ -1723,6 +2181,11 @@ void VspSurf::Tesselate( const vector<int> &num_u, int num_v, std::vector< vecto
     MakeVTess( num_v, v, n_cap, degen );
     MakeUTess( u, num_u, umerge, n_cap, n_default );
 
+    if ( !degen ) // DegenGeom relies on the fixed V layout
+    {
+        RefineTess( u, v );
+    }
+
     Tesselate( u, v, pnts, norms, uw_pnts );
 }
 
@@ -1743,13 +2206,154 @@ void VspSurf::SplitTesselate( const vector<int> &num_u, int num_v, std::vector<
     MakeVTess( num_v, v, n_cap, false );
     MakeUTess( u, num_u, umerge, n_cap, n_default );
 
+    RefineTess( u, v );
+
     SplitTesselate( m_UFeature, m_WFeature, u, v, pnts, norms );
 }
 
+// VspSurf::SplitTesselate
+// VspSurf::Tesselate
+// Splits u and v intervals at their midpoints until each midpoint lies within the
+// chord tolerance of the interval's chord and the normals at its ends agree within
+// the angle tolerance.  Existing parameters are kept, so feature lines still land on
+// the grid.  U intervals that span a patch boundary ( skipped or merged sections )
+// and the short magic intervals at wing edges are left alone.
+void VspSurf::RefineTess( vector < double > &u, vector < double > &v ) const
+{
+    if ( !GetTessAdaptFlag() || u.size() < 2 || v.size() < 2 )
+    {
+        return;
+    }
+
+    BndBox bb;
+    GetBoundingBox( bb );
+    double chord_tol = m_TessChordTol * bb.DiagDist();
+    double cos_tol = cos( m_TessAngleTol * PI / 180.0 );
+    bool chord_flag = m_TessChordTol > 0.0;
+    bool angle_flag = m_TessAngleTol > 0.0;
+
+    vector < double > ubound;
+    m_Surface.get_pmap_u( ubound );
+    double ueps = 1e-10 * ( u.back() - u.front() );
+    double umin_step = 1e-4 * ( u.back() - u.front() );
+    double vmin_step = 1e-4 * ( v.back() - v.front() );
+    if ( IsMagicVParm() )
+    {
+        vmin_step = std::max( vmin_step, 2.5 * TMAGIC );
+    }
+
+    size_t max_pnts = 16 * u.size() * v.size();
+
+    vector < vector < vec3d > > pnts, norms, mid_pnts;
+    vector < double > mid, refined;
+    vector < bool > split;
+
+    for ( int level = 0; level < m_TessAdaptLevel; level++ )
+    {
+        int nu = u.size();
+        int nv = v.size();
+
+        EvalGrid( u, v, &pnts, NULL, NULL, &norms );
+
+        bool any_split = false;
+
+        //==== U Intervals ====//
+        mid.resize( nu - 1 );
+        for ( int i = 0; i < nu - 1; i++ )
+        {
+            mid[i] = 0.5 * ( u[i] + u[i + 1] );
+        }
+        EvalGrid( mid, v, &mid_pnts, NULL, NULL, NULL );
+
+        split.assign( nu - 1, false );
+        for ( int i = 0; i < nu - 1; i++ )
+        {
+            if ( u[i + 1] - u[i] < umin_step )
+            {
+                continue;
+            }
+
+            vector < double >::iterator b = std::upper_bound( ubound.begin(), ubound.end(), u[i] + ueps );
+            if ( b != ubound.end() && *b < u[i + 1] - ueps )
+            {
+                continue;
+            }
+
+            for ( int j = 0; j < nv && !split[i]; j++ )
+            {
+                split[i] = ( chord_flag && dist( mid_pnts[i][j], 0.5 * ( pnts[i][j] + pnts[i + 1][j] ) ) > chord_tol ) ||
+                           ( angle_flag && dot( norms[i][j], norms[i + 1][j] ) < cos_tol );
+            }
+            any_split = any_split || split[i];
+        }
+
+        vector < bool > usplit = split;
+
+        //==== V Intervals ====//
+        mid.resize( nv - 1 );
+        for ( int j = 0; j < nv - 1; j++ )
+        {
+            mid[j] = 0.5 * ( v[j] + v[j + 1] );
+        }
+        EvalGrid( u, mid, &mid_pnts, NULL, NULL, NULL );
+
+        split.assign( nv - 1, false );
+        for ( int j = 0; j < nv - 1; j++ )
+        {
+            if ( v[j + 1] - v[j] < vmin_step )
+            {
+                continue;
+            }
+
+            for ( int i = 0; i < nu && !split[j]; i++ )
+            {
+                split[j] = ( chord_flag && dist( mid_pnts[i][j], 0.5 * ( pnts[i][j] + pnts[i][j + 1] ) ) > chord_tol ) ||
+                           ( angle_flag && dot( norms[i][j], norms[i][j + 1] ) < cos_tol );
+            }
+            any_split = any_split || split[j];
+        }
+
+        if ( !any_split )
+        {
+            break;
+        }
+
+        //==== Insert Midpoints ====//
+        refined.clear();
+        for ( int i = 0; i < nu - 1; i++ )
+        {
+            refined.push_back( u[i] );
+            if ( usplit[i] )
+            {
+                refined.push_back( 0.5 * ( u[i] + u[i + 1] ) );
+            }
+        }
+        refined.push_back( u.back() );
+        u.swap( refined );
+
+        refined.clear();
+        for ( int j = 0; j < nv - 1; j++ )
+        {
+            refined.push_back( v[j] );
+            if ( split[j] )
+            {
+                refined.push_back( 0.5 * ( v[j] + v[j + 1] ) );
+            }
+        }
+        refined.push_back( v.back() );
+        v.swap( refined );
+
+        if ( u.size() * v.size() > max_pnts )
+        {
+            break;
+        }
+    }
+}
+
 // VspSurf::SplitTesselate
 // VspSurf::Tesselate
 // VspSurf::TesselateTEforWake
-// Low level routine that actually calls Code-Eli to evaluate grid of points.
+// Low level routine that evaluates a grid of points through the batched kernel.
 // No smarts about what U/V tess to work on, just evaluates what it is told.
 // Also called by SplitTess below.
 void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const
@@ -1763,25 +2367,16 @@ void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::
     unsigned int nu = (unsigned int)u.size();
     unsigned int nv = (unsigned int)v.size();
 
-    vector < vector < surface_point_type > > ptmat, nmat;
-
-    m_Surface.f_pt_normal_grid( u, v, ptmat, nmat);
+    EvalGrid( u, v, &pnts, NULL, NULL, &norms );
 
-    // resize pnts and norms
-    pnts.resize( nu );
-    norms.resize( nu );
     uw_pnts.resize( nu );
     for ( surface_index_type i = 0; i < nu; ++i )
     {
-        pnts[i].resize( nv );
-        norms[i].resize( nv );
         uw_pnts[i].resize( nv );
 
         for ( surface_index_type j = 0; j < nv; j++ )
         {
-            pnts[i][j] = ptmat[i][j];
-
-            vec3d norm = nmat[i][j];
+            vec3d norm = norms[i][j];
             if ( norm.mag() < 1e-6 ) // Zero normal vector
             {
                 double tmax = GetWMax();
@@ -184,6 +184,12 @@ public:
     void CompCurvature( double u, double w, double& k1, double& k2, double& ka, double& kg ) const;
     void CompCurvature01( double u, double w, double& k1, double& k2, double& ka, double& kg ) const;
 
+    //===== Batched Evaluation ====//
+    void CompPntNormGrid( const vector < double > &u, const vector < double > &w, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &norms ) const;
+    void CompGrid( const vector < double > &u, const vector < double > &w, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &tanu, vector< vector< vec3d > > &tanw, vector< vector< vec3d > > &norms ) const;
+    void CompPntVec( const vector < double > &u, const vector < double > &w, vector < vec3d > &pnts ) const;
+    void CompNormVec( const vector < double > &u, const vector < double > &w, vector < vec3d > &norms ) const;
+
     int GetNumUFeature() const
     {
         return m_UFeature.size();
@@ -216,6 +222,16 @@ public:
     double GetRootCluster( const int &index ) const;
     double GetTipCluster( const int &index ) const;
 
+    // Adaptive refinement of the tessellation.  chord_tol is a fraction of the bounding box diagonal and
+    // angle_tol is in degrees.  A non-positive tolerance turns that test off, max_level of zero turns
+    // refinement off.
+    void SetTessAdapt( const double &chord_tol, const double &angle_tol, const int &max_level );
+    bool GetTessAdaptFlag() const
+    {
+        return m_TessAdaptLevel > 0 && ( m_TessChordTol > 0.0 || m_TessAngleTol > 0.0 );
+    }
+    void RefineTess( vector < double > &u, vector < double > &v ) const;
+
     void MakeUTess( vector < double > &u, const vector < int > &num_u, const std::vector < int > &umerge, const int &n_cap, const int &n_default ) const;
     void MakeVTess( int num_v, std::vector<double> &vtess, const int &n_cap, bool degen ) const;
 
@@ -346,6 +362,9 @@ protected:
     void Tesselate( const vector<double> &utess, const vector<double> &vtess, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const;
     void SplitTesselate( const vector<double> &usplit, const vector<double> &vsplit, const vector<double> &u, const vector<double> &v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms ) const;
 
+    void EvalGrid( const vector < double > &u, const vector < double > &w, vector< vector< vec3d > > *pnts, vector< vector< vec3d > > *tanu, vector< vector< vec3d > > *tanw, vector< vector< vec3d > > *norms ) const;
+    void EvalVec( const vector < double > &u, const vector < double > &w, vector < vec3d > *pnts, vector < vec3d > *norms ) const;
+
     static bool CheckValidPatch( const piecewise_surface_type &surf );
 
     bool m_FlipNormal;
@@ -395,5 +414,9 @@ private:
     mutable vector < double > m_RootCluster;
     mutable vector < double > m_TipCluster;
 
+    double m_TessChordTol;
+    double m_TessAngleTol;
+    int m_TessAdaptLevel;
+
 };
 #endif
@@ -4,6 +4,7 @@
 #include <vector>
 #include <string>
 #include "Vec3d.h"
+#include "TextBuffer.h"
 #include <cfloat>
 
 class WriteMatlab
@@ -13,9 +14,9 @@ public:
     {
     }
 
-    virtual void write( FILE* file_id, const string &name )
+    virtual void write( TextBuffer &buf, const string &name )
     {
-        fprintf( file_id, "%s = %.*e;\n", name.c_str(), DBL_DIG + 3, get() );
+        buf.Printf( "%s = %.*e;\n", name.c_str(), DBL_DIG + 3, get() );
     }
 
     virtual double get() = 0;
@@ -24,43 +25,43 @@ public:
 class WriteDoubleM : public WriteMatlab
 {
 public:
-    virtual void write( FILE* file_id, const double &d, const string &name )
+    virtual void write( TextBuffer &buf, const double &d, const string &name )
     {
-        data = d;
-        WriteMatlab::write( file_id, name );
+        data = &d;
+        WriteMatlab::write( buf, name );
     }
 
     double get()
     {
-        return data;
+        return *data;
     }
 
 protected:
-    double data;
+    const double *data;
 };
 
 class WriteVec3dM : public WriteMatlab
 {
 public:
-    virtual void write( FILE* file_id, const vec3d &d, const string &basename )
+    virtual void write( TextBuffer &buf, const vec3d &d, const string &basename )
     {
-        data = d;
+        data = &d;
         string suffix[] = {"x", "y", "z"};
         for( dim = 0; dim < 3; dim++ )
         {
             string name = basename;
             name.append( suffix[dim] );
-            WriteMatlab::write( file_id, name );
+            WriteMatlab::write( buf, name );
         }
     }
 
     double get()
     {
-        return data.v[dim];
+        return data->v[dim];
     }
 
 protected:
-    vec3d data;
+    const vec3d *data;
     int dim;
 };
 
@@ -71,17 +72,17 @@ public:
     {
     }
 
-    virtual void write( FILE* file_id, const string &name, const int &num )
+    virtual void write( TextBuffer &buf, const string &name, const int &num )
     {
         int i;
-        fprintf( file_id, "\n%s = [", name.c_str() );
+        buf.Printf( "\n%s = [", name.c_str() );
 
         for ( i = 0; i < num - 1; i++ )
         {
-            fprintf( file_id, "%.*e;\n", DBL_DIG + 3, get( i ) );
+            buf.Printf( "%.*e;\n", DBL_DIG + 3, get( i ) );
         }
 
-        fprintf( file_id, "%.*e];\n", DBL_DIG + 3, get( i ) );
+        buf.Printf( "%.*e];\n", DBL_DIG + 3, get( i ) );
     }
 
     virtual double get( int i ) = 0;
@@ -90,43 +91,43 @@ public:
 class WriteVecDoubleM : public WriteMatlabVec
 {
 public:
-    virtual void write( FILE* file_id, const vector< double > &d, const string &name, const int &num )
+    virtual void write( TextBuffer &buf, const vector< double > &d, const string &name, const int &num )
     {
-        data = d;
-        WriteMatlabVec::write( file_id, name, num );
+        data = &d;
+        WriteMatlabVec::write( buf, name, num );
     }
 
     double get( int i )
     {
-        return data[i];
+        return ( *data )[i];
     }
 
 protected:
-    vector< double > data;
+    const vector< double > *data;
 };
 
 class WriteVecVec3dM : public WriteMatlabVec
 {
 public:
-    virtual void write( FILE* file_id, const vector< vec3d > &d, const string &basename, const int &num )
+    virtual void write( TextBuffer &buf, const vector< vec3d > &d, const string &basename, const int &num )
     {
-        data = d;
+        data = &d;
         string suffix[] = {"x", "y", "z"};
         for( dim = 0; dim < 3; dim++ )
         {
             string name = basename;
             name.append( suffix[dim] );
-            WriteMatlabVec::write( file_id, name, num );
+            WriteMatlabVec::write( buf, name, num );
         }
     }
 
     double get( int i )
     {
-        return data[i].v[dim];
+        return ( *data )[i].v[dim];
     }
 
 protected:
-    vector< vec3d > data;
+    const vector< vec3d > *data;
     int dim;
 };
 
@@ -137,24 +138,24 @@ public:
     {
     }
 
-    virtual void write( FILE* file_id, const string &name, const int &numi, const int &numj )
+    virtual void write( TextBuffer &buf, const string &name, const int &numi, const int &numj )
     {
         int i, j;
 
-        fprintf( file_id, "\n%s = [", name.c_str() );
+        buf.Printf( "\n%s = [", name.c_str() );
         for ( i = 0; i < numi; i++ )
         {
             for ( j = 0; j < numj - 1; j++ )
             {
-                fprintf( file_id, "%.*e, ", DBL_DIG + 3, get( i, j ) );
+                buf.Printf( "%.*e, ", DBL_DIG + 3, get( i, j ) );
             }
             if ( i < numi - 1 )
             {
-                fprintf( file_id, "%.*e;\n", DBL_DIG + 3, get( i, j ) );
+                buf.Printf( "%.*e;\n", DBL_DIG + 3, get( i, j ) );
             }
             else
             {
-                fprintf( file_id, "%.*e];\n", DBL_DIG + 3, get( i, j ) );
+                buf.Printf( "%.*e];\n", DBL_DIG + 3, get( i, j ) );
             }
         }
     }
@@ -165,43 +166,43 @@ public:
 class WriteMatDoubleM : public WriteMatlabMat
 {
 public:
-    virtual void write( FILE* file_id, const vector< vector< double > > &d, const string &name, const int &numi, const int &numj )
+    virtual void write( TextBuffer &buf, const vector< vector< double > > &d, const string &name, const int &numi, const int &numj )
     {
-        data = d;
-        WriteMatlabMat::write( file_id, name, numi, numj );
+        data = &d;
+        WriteMatlabMat::write( buf, name, numi, numj );
     }
 
     double get( int i, int j )
     {
-        return data[i][j];
+        return ( *data )[i][j];
     }
 
 protected:
-    vector< vector< double > > data;
+    const vector< vector< double > > *data;
 };
 
 class WriteMatVec3dM : public WriteMatlabMat
 {
 public:
-    virtual void write( FILE* file_id, const vector< vector< vec3d > > &d, const string &basename, const int &numi, const int &numj )
+    virtual void write( TextBuffer &buf, const vector< vector< vec3d > > &d, const string &basename, const int &numi, const int &numj )
     {
-        data = d;
+        data = &d;
         string suffix[] = {"x", "y", "z"};
         for( dim = 0; dim < 3; dim++ )
         {
             string name = basename;
             name.append( suffix[dim] );
-            WriteMatlabMat::write( file_id, name, numi, numj );
+            WriteMatlabMat::write( buf, name, numi, numj );
         }
     }
 
     double get( int i, int j )
     {
-        return data[i][j].v[dim];
+        return ( *data )[i][j].v[dim];
     }
 
 protected:
-    vector< vector< vec3d > > data;
+    const vector< vector< vec3d > > *data;
     int dim;
 };
 
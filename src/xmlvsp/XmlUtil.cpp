@@ -30,6 +30,29 @@ unsigned int XmlUtil::GetNumNames( xmlNodePtr node, const char * name )
     return num;
 }
 
+//==== Get All Nodes w/ Name ====//
+vector< xmlNodePtr > XmlUtil::GetNodeVec( xmlNodePtr node, const char * name )
+{
+    vector< xmlNodePtr > node_vec;
+
+    if ( node == NULL )
+    {
+        return node_vec;
+    }
+
+    xmlNodePtr iter_node = node->xmlChildrenNode;
+    while( iter_node != NULL )
+    {
+        if ( !xmlStrcmp( iter_node->name, ( const xmlChar * )name ) )
+        {
+            node_vec.push_back( iter_node );
+        }
+        iter_node = iter_node->next;
+    }
+
+    return node_vec;
+}
+
 //==== Get Node w/ Name and ID (Seq Num 0 - n ) ====//
 xmlNodePtr XmlUtil::GetNodeDbg( xmlNodePtr node, const char * name, int id, const char* file, int lineno )
 {
@@ -668,6 +691,209 @@ vector< vec3d > XmlUtil::GetVectorVec3dNode( xmlNodePtr node )
     return ret_vec;
 }
 
+//==== Binary Block Helpers ====//
+// Doubles per "Block" child -- keeps each base64 text node well under
+// the default libxml2 text node limit.
+static const int BinaryBlockSize = 262144;
+
+static const char Base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static bool IsLittleEndian()
+{
+    const unsigned short one = 1;
+    return *( ( const unsigned char * ) &one ) == 1;
+}
+
+// Copy doubles to little-endian bytes.
+static void PackDoubles( const double * data, int num, vector< unsigned char > & bytes )
+{
+    bytes.resize( num * sizeof( double ) );
+    if ( num == 0 )
+    {
+        return;
+    }
+    memcpy( &bytes[0], data, bytes.size() );
+
+    if ( !IsLittleEndian() )
+    {
+        for ( size_t i = 0 ; i < bytes.size() ; i += sizeof( double ) )
+        {
+            std::reverse( bytes.begin() + i, bytes.begin() + i + sizeof( double ) );
+        }
+    }
+}
+
+static void Base64Encode( const vector< unsigned char > & bytes, string & out )
+{
+    size_t len = bytes.size();
+    out.resize( 4 * ( ( len + 2 ) / 3 ) );
+
+    size_t i = 0;
+    size_t j = 0;
+    for ( ; i + 2 < len ; i += 3 )
+    {
+        unsigned int v = ( bytes[i] << 16 ) | ( bytes[i + 1] << 8 ) | bytes[i + 2];
+        out[j++] = Base64Chars[( v >> 18 ) & 0x3F];
+        out[j++] = Base64Chars[( v >> 12 ) & 0x3F];
+        out[j++] = Base64Chars[( v >> 6 ) & 0x3F];
+        out[j++] = Base64Chars[v & 0x3F];
+    }
+
+    if ( i < len )
+    {
+        unsigned int v = bytes[i] << 16;
+        if ( i + 1 < len )
+        {
+            v |= bytes[i + 1] << 8;
+        }
+        out[j++] = Base64Chars[( v >> 18 ) & 0x3F];
+        out[j++] = Base64Chars[( v >> 12 ) & 0x3F];
+        out[j++] = ( i + 1 < len ) ? Base64Chars[( v >> 6 ) & 0x3F] : '=';
+        out[j++] = '=';
+    }
+}
+
+struct Base64Table
+{
+    Base64Table()
+    {
+        for ( int i = 0 ; i < 256 ; i++ )
+        {
+            m_Val[i] = -1;
+        }
+        for ( int i = 0 ; i < 64 ; i++ )
+        {
+            m_Val[( unsigned char ) Base64Chars[i]] = i;
+        }
+    }
+    int m_Val[256];
+};
+
+// Decode base64 text into bytes, skipping whitespace.  Returns number of bytes written.
+static size_t Base64Decode( const char * str, unsigned char * bytes, size_t max_len )
+{
+    static const Base64Table table;
+
+    size_t n = 0;
+    unsigned int v = 0;
+    int bits = 0;
+    for ( const unsigned char * c = ( const unsigned char * ) str ; *c && *c != '=' ; c++ )
+    {
+        int d = table.m_Val[*c];
+        if ( d < 0 )
+        {
+            continue;
+        }
+        v = ( v << 6 ) | d;
+        bits += 6;
+        if ( bits >= 8 )
+        {
+            bits -= 8;
+            if ( n < max_len )
+            {
+                bytes[n++] = ( unsigned char )( ( v >> bits ) & 0xFF );
+            }
+        }
+    }
+    return n;
+}
+
+//==== Create Node and Add Binary Block of Doubles ====//
+xmlNodePtr XmlUtil::AddBinaryDoubleNode( xmlNodePtr root, const char * name, const vector< double > & vec )
+{
+    xmlNodePtr node = xmlNewChild( root, NULL, ( const xmlChar * )name, NULL );
+    SetStringProp( node, "Encoding", "base64" );
+    SetIntProp( node, "Num", ( int )vec.size() );
+
+    vector< unsigned char > bytes;
+    string str;
+    for ( int start = 0 ; start < ( int )vec.size() ; start += BinaryBlockSize )
+    {
+        int num = std::min( BinaryBlockSize, ( int )vec.size() - start );
+        PackDoubles( &vec[start], num, bytes );
+        Base64Encode( bytes, str );
+
+        xmlNodePtr block_node = xmlNewChild( node, NULL, BAD_CAST "Block", NULL );
+        xmlNodeAddContentLen( block_node, ( const xmlChar * )str.c_str(), ( int )str.size() );
+    }
+
+    return node;
+}
+
+//==== Create Node and Add Binary Block of Vec3ds ====//
+xmlNodePtr XmlUtil::AddBinaryVec3dNode( xmlNodePtr root, const char * name, const vector< vec3d > & vec )
+{
+    vector< double > xyz_vec( 3 * vec.size() );
+    for ( int i = 0 ; i < ( int )vec.size() ; i++ )
+    {
+        xyz_vec[3 * i]     = vec[i].x();
+        xyz_vec[3 * i + 1] = vec[i].y();
+        xyz_vec[3 * i + 2] = vec[i].z();
+    }
+
+    return AddBinaryDoubleNode( root, name, xyz_vec );
+}
+
+//==== Get Binary Block of Doubles ====//
+vector< double > XmlUtil::GetBinaryDoubleNode( xmlNodePtr node )
+{
+    vector< double > ret_vec;
+
+    int num = FindIntProp( node, "Num", 0 );
+    if ( num <= 0 )
+    {
+        return ret_vec;
+    }
+    ret_vec.resize( num );
+
+    unsigned char * bytes = ( unsigned char * ) &ret_vec[0];
+    size_t max_len = num * sizeof( double );
+    size_t n = 0;
+
+    xmlNodePtr iter_node = node->xmlChildrenNode;
+    while( iter_node != NULL && n < max_len )
+    {
+        if ( !xmlStrcmp( iter_node->name, ( const xmlChar * )"Block" ) )
+        {
+            xmlChar * content = xmlNodeGetContent( iter_node );
+            if ( content )
+            {
+                n += Base64Decode( ( const char * ) content, bytes + n, max_len - n );
+                xmlFree( content );
+            }
+        }
+        iter_node = iter_node->next;
+    }
+
+    // Truncated data -- keep only whole values.
+    ret_vec.resize( n / sizeof( double ) );
+
+    if ( !IsLittleEndian() )
+    {
+        for ( size_t i = 0 ; i < ret_vec.size() ; i++ )
+        {
+            unsigned char * b = bytes + i * sizeof( double );
+            std::reverse( b, b + sizeof( double ) );
+        }
+    }
+
+    return ret_vec;
+}
+
+//==== Get Binary Block of Vec3ds ====//
+vector< vec3d > XmlUtil::GetBinaryVec3dNode( xmlNodePtr node )
+{
+    vector< double > xyz_vec = GetBinaryDoubleNode( node );
+
+    vector< vec3d > ret_vec( xyz_vec.size() / 3 );
+    for ( int i = 0 ; i < ( int )ret_vec.size() ; i++ )
+    {
+        ret_vec[i].set_xyz( xyz_vec[3 * i], xyz_vec[3 * i + 1], xyz_vec[3 * i + 2] );
+    }
+
+    return ret_vec;
+}
+
 //==== Encode File Contents ====//
 xmlNodePtr XmlUtil::EncodeFileContents( xmlNodePtr root, const char* file_name )
 {
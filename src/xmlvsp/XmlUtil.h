@@ -27,6 +27,9 @@ unsigned int GetNumNames( xmlNodePtr node, const char * name );
 #define GetNode( node, name, num ) GetNodeDbg( node, name, num, __FILE__, __LINE__ )
 xmlNodePtr GetNodeDbg( xmlNodePtr node, const char * name, int num, const char* file, int lineno );
 
+// All children with name, in order -- one pass instead of GetNode( node, name, i ) in a loop.
+vector< xmlNodePtr > GetNodeVec( xmlNodePtr node, const char * name );
+
 double ExtractDouble( xmlNodePtr node );
 int    ExtractInt( xmlNodePtr node );
 string ExtractString( xmlNodePtr node );
@@ -68,6 +71,13 @@ vec2d GetVec2dNode( xmlNodePtr node );
 vec3d GetVec3dNode( xmlNodePtr node );
 vector< vec3d > GetVectorVec3dNode( xmlNodePtr node );
 
+// Bulk arrays stored as little-endian doubles, base64 encoded in bounded
+// "Block" children so no single text node hits the parser size limit.
+xmlNodePtr AddBinaryDoubleNode( xmlNodePtr root, const char * name, const vector< double > & vec );
+xmlNodePtr AddBinaryVec3dNode( xmlNodePtr root, const char * name, const vector< vec3d > & vec );
+vector< double > GetBinaryDoubleNode( xmlNodePtr node );
+vector< vec3d > GetBinaryVec3dNode( xmlNodePtr node );
+
 xmlNodePtr EncodeFileContents( xmlNodePtr root, const char* file_name );
 xmlNodePtr DecodeFileContents( xmlNodePtr root, const char* file_name );
 